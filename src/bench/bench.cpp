@@ -0,0 +1,65 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include <cstdio>
+
+
+static const void* volatile g_sink = nullptr;
+
+/**
+* @brief register a benchmark
+* @param name
+* @param function
+*/
+BenchmarkRegistration::BenchmarkRegistration( const char* name, void ( *function )() )
+{
+	benchmarks().push_back( Benchmark{ name, function } );
+}
+
+/**
+* @brief get every registered benchmark
+* @return benchmarks
+*/
+std::vector<Benchmark>& benchmarks()
+{
+	static std::vector<Benchmark> registered;
+	return registered;
+}
+
+/**
+* @brief keep the compiler from removing the computation of a value
+* @param value
+*/
+void do_not_optimize( const void* value )
+{
+	g_sink = value;
+}
+
+/**
+* @brief print the time of a measurement
+* @param label
+* @param nanoseconds
+*/
+void report( const char* label, const double nanoseconds )
+{
+	printf( "  %-40s %12.2f ns\n", label, nanoseconds );
+}
+
+/**
+* @brief print the speedup between two measurements
+* @param label
+* @param before	nanoseconds
+* @param after		nanoseconds
+*/
+void report_speedup( const char* label, const double before, const double after )
+{
+	printf( "  %-40s %12.2fx\n", label, before / after );
+}
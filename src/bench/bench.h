@@ -0,0 +1,64 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+struct Benchmark
+{
+	std::string name;
+	void ( *function )();
+};
+
+struct BenchmarkRegistration
+{
+	BenchmarkRegistration( const char* name, void ( *function )() );
+};
+
+// defines a benchmark run by the bench executable
+#define BENCHMARK( group, name )																		\
+	static void bench_##group##_##name();																\
+	static BenchmarkRegistration registration_##group##_##name( #group "." #name, bench_##group##_##name );	\
+	static void bench_##group##_##name()
+
+std::vector<Benchmark>& benchmarks();
+
+void do_not_optimize( const void* value );
+void report( const char* label, const double nanoseconds );
+void report_speedup( const char* label, const double before, const double after );
+
+/**
+* @brief time a function, the best of several runs is kept to ignore the noise
+* @param function	called once per iteration
+* @param iterations
+* @return nanoseconds per iteration
+*/
+template <typename Function>
+double time_per_call( Function function, const unsigned iterations )
+{
+	const unsigned runs = 5u;
+	double best = std::numeric_limits<double>::max();
+
+	for ( unsigned run = 0u; run < runs; run++ )
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+		for ( unsigned i = 0u; i < iterations; i++ )
+			function( i );
+		const auto end = std::chrono::high_resolution_clock::now();
+
+		const double time = std::chrono::duration<double, std::nano>( end - start ).count();
+		best = time < best ? time : best;
+	}
+
+	return best / iterations;
+}
@@ -0,0 +1,456 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include "box_collision.h"
+#include "collision.h"
+#include "sphere_collision.h"
+#include "gjk.h"
+#include "sat_cache.h"
+#include "manifold_cache.h"
+#include "simd.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+
+/**
+* @brief	pairs of cubes with random orientations whose bounding boxes overlap but that do not
+*			collide, the candidate pairs the broadphase gives to the narrowphase
+*/
+static std::vector<RigidBody> separated_pairs( const unsigned count )
+{
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 1.0f, 1.7f );
+
+	std::vector<RigidBody> bodies;
+	while ( bodies.size() < count * 2u )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = load_shared_mesh( "cube" );
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+
+		ContactManifold contact;
+		if ( overlap_sat( a, b, contact ) )
+			continue;
+
+		bodies.push_back( a );
+		bodies.push_back( b );
+	}
+
+	return bodies;
+}
+
+BENCHMARK( collision, sat_cache )
+{
+	const unsigned count = 256u;
+	const unsigned iterations = 20000u;
+
+	std::vector<RigidBody> bodies = separated_pairs( count );
+
+	// the full query of every pair
+	const double before = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		ContactManifold contact;
+		const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	// the axis of the last query, the pairs do not move
+	SatCache cache;
+	for ( unsigned pair = 0u; pair < count; pair++ )
+	{
+		ContactManifold contact;
+		overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, &cache.find( pair * 2u, pair * 2u + 1u ) );
+	}
+
+	const double after = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		ContactManifold contact;
+		const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, &cache.find( pair * 2u, pair * 2u + 1u ) );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	report( "full query of separated pairs", before );
+	report( "cached separating axis", after );
+	report_speedup( "speedup", before, after );
+}
+
+BENCHMARK( collision, unique_edges )
+{
+	const unsigned iterations = 20u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+
+	// touching pairs, where the edge query can not stop early
+	for ( const char* name : { "cube", "cylinder", "sphere" } )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = load_shared_mesh( name );
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = vec3( 0.3f, 0.9f, 0.2f );
+
+		const double before = time_per_call( [&]( const unsigned )
+		{
+			const ContactEdge contact = has_separating_axis_edge_bruteforce( a, b );
+			do_not_optimize( &contact );
+		}, iterations );
+
+		const double after = time_per_call( [&]( const unsigned )
+		{
+			const ContactEdge contact = has_separating_axis_edge_scalar( a, b );
+			do_not_optimize( &contact );
+		}, iterations );
+
+		const std::string label = std::string( name ) + " " + std::to_string( a.mesh->unique_edges().size() ) + " edges";
+		report( ( label + ", edges of every face pair" ).c_str(), before );
+		report( ( label + ", unique edge table" ).c_str(), after );
+		report_speedup( "speedup", before, after );
+	}
+}
+
+BENCHMARK( collision, wide_edges )
+{
+	const unsigned iterations = 20u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+
+	// touching pairs, where the edge query can not stop early
+	const char* pairs[][2] = { { "sphere", "sphere" }, { "cylinder", "cube" } };
+	for ( const auto& pair : pairs )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = load_shared_mesh( pair[0] );
+		b.mesh = load_shared_mesh( pair[1] );
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = vec3( 0.3f, 0.9f, 0.2f );
+
+		const double faces = time_per_call( [&]( const unsigned )
+		{
+			const ContactEdge contact = has_separating_axis_edge_bruteforce( a, b );
+			do_not_optimize( &contact );
+		}, iterations );
+
+		const double scalar = time_per_call( [&]( const unsigned )
+		{
+			const ContactEdge contact = has_separating_axis_edge_scalar( a, b );
+			do_not_optimize( &contact );
+		}, iterations * 10u );
+
+		const double wide = time_per_call( [&]( const unsigned )
+		{
+			const ContactEdge contact = has_separating_axis_edge( a, b );
+			do_not_optimize( &contact );
+		}, iterations * 10u );
+
+		const std::string label = std::string( pair[0] ) + " vs " + pair[1];
+		report( ( label + ", create_minkowski_face" ).c_str(), faces );
+		report( ( label + ", scalar edge table" ).c_str(), scalar );
+		report( ( label + ", " SIMD_NAME " edge table" ).c_str(), wide );
+		report_speedup( "speedup over create_minkowski_face", faces, wide );
+		report_speedup( "speedup over scalar", scalar, wide );
+	}
+}
+
+BENCHMARK( collision, sat_vs_gjk )
+{
+	const unsigned count = 64u;
+	const unsigned iterations = 2000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 1.2f, 1.9f );
+
+	// pairs of the same mesh close enough to collide or be near, the time is the mean of both
+	for ( const char* name : { "octohedron", "cube", "icosahedron", "cylinder", "sphere", "gourd" } )
+	{
+		std::vector<RigidBody> bodies;
+		for ( unsigned i = 0u; i < count; i++ )
+		{
+			RigidBody a;
+			RigidBody b;
+			a.mesh = b.mesh = load_shared_mesh( name );
+			a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+			b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+			b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+			bodies.push_back( a );
+			bodies.push_back( b );
+		}
+
+		const double sat = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned pair = i % count;
+			ContactManifold contact;
+			const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact );
+			do_not_optimize( &colliding );
+		}, iterations );
+
+		const double gjk = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned pair = i % count;
+			ContactManifold contact;
+			const bool colliding = overlap_gjk( bodies[pair * 2u], bodies[pair * 2u + 1u], contact );
+			do_not_optimize( &colliding );
+		}, iterations );
+
+		const std::string label = std::string( name ) + " " + std::to_string( load_shared_mesh( name )->vertices().size() ) + " vertices";
+		report( ( label + ", sat" ).c_str(), sat );
+		report( ( label + ", gjk + epa" ).c_str(), gjk );
+		report_speedup( "speedup of gjk", sat, gjk );
+	}
+}
+
+BENCHMARK( collision, warm_supports )
+{
+	const unsigned iterations = 200u;
+
+	// overlapping pairs, where the face query visits every face
+	for ( const char* name : { "cube", "cylinder", "sphere" } )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = load_shared_mesh( name );
+		b.position = vec3( 0.3f, 0.7f, 0.2f );
+		const quat spin = quat( vec3( 0.002f, 0.001f, -0.0015f ) );
+
+		// the other body turns a little every query, as between steps
+		const double cold = time_per_call( [&]( const unsigned )
+		{
+			b.rot = normalize( spin * b.rot );
+			const ContactFace contact = has_separating_axis_face( a, b );
+			do_not_optimize( &contact );
+		}, iterations );
+
+		std::vector<unsigned> supports;
+		const double warm = time_per_call( [&]( const unsigned )
+		{
+			b.rot = normalize( spin * b.rot );
+			const ContactFace contact = has_separating_axis_face( a, b, &supports );
+			do_not_optimize( &contact );
+		}, iterations );
+
+		const std::string label = std::string( name ) + " " + std::to_string( a.mesh->faces().size() ) + " faces";
+		report( ( label + ", from the support of the previous face" ).c_str(), cold );
+		report( ( label + ", from the last support of the face" ).c_str(), warm );
+		report_speedup( "speedup", cold, warm );
+	}
+}
+
+BENCHMARK( collision, box_box )
+{
+	const unsigned count = 64u;
+	const unsigned iterations = 5000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 0.9f, 1.6f );
+
+	// boxes close enough to collide or be near, as the pairs of the broadphase
+	std::vector<RigidBody> bodies;
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = load_shared_mesh( "cube" );
+		a.shape = b.shape = ShapeType::Box;
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+		bodies.push_back( a );
+		bodies.push_back( b );
+	}
+
+	// transformations of the step, read by every routine as in the physics
+	std::vector<BodyTransform> transforms;
+	for ( const RigidBody& body : bodies )
+		transforms.push_back( make_body_transform( body ) );
+
+	const double sat = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const PairTransform transform = make_pair_transform( transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		ContactManifold contact;
+		const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, nullptr, &transform );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	const double box = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		ContactManifold contact;
+		const bool colliding = overlap_box_box( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	report( "generic sat of the half edge meshes", sat );
+	report( "15 axes of the boxes", box );
+	report_speedup( "speedup", sat, box );
+}
+
+BENCHMARK( collision, spheres )
+{
+	const unsigned count = 64u;
+	const unsigned iterations = 5000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 1.7f, 2.1f );
+
+	// pairs of spheres of radius 1 close enough to collide or be near
+	std::vector<RigidBody> bodies;
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = load_shared_mesh( "sphere" );
+		a.shape = b.shape = ShapeType::Sphere;
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+		bodies.push_back( a );
+		bodies.push_back( b );
+	}
+
+	// transformations of the step, read by every routine as in the physics
+	std::vector<BodyTransform> transforms;
+	for ( const RigidBody& body : bodies )
+		transforms.push_back( make_body_transform( body ) );
+
+	const double sat = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const PairTransform transform = make_pair_transform( transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		ContactManifold contact;
+		const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, nullptr, &transform );
+		do_not_optimize( &colliding );
+	}, iterations / 10u );
+
+	const double gjk = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const PairTransform transform = make_pair_transform( transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		ContactManifold contact;
+		const bool colliding = overlap_gjk( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, &transform );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	const double sphere = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		ContactManifold contact;
+		const bool colliding = overlap_sphere( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	report( "sat of the tessellated spheres", sat );
+	report( "gjk + epa of the tessellated spheres", gjk );
+	report( "analytic spheres", sphere );
+	report_speedup( "speedup over gjk", gjk, sphere );
+}
+
+BENCHMARK( collision, persistent_manifolds )
+{
+	const unsigned count = 64u;
+	const unsigned iterations = 5000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> offset( -2.0f, 2.0f );
+
+	// cubes resting on a floor, the contacts of a stack that is about to sleep
+	std::vector<RigidBody> bodies;
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		RigidBody floor;
+		RigidBody box;
+		floor.mesh = box.mesh = load_shared_mesh( "cube" );
+		floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+		box.rot = quat( vec3( 0.0f, angle( generator ), 0.0f ) );
+		box.position = vec3( offset( generator ), 0.99f, offset( generator ) );
+		bodies.push_back( floor );
+		bodies.push_back( box );
+	}
+
+	// transformations of the step, read by every routine as in the physics
+	std::vector<BodyTransform> transforms;
+	for ( const RigidBody& body : bodies )
+		transforms.push_back( make_body_transform( body ) );
+
+	std::vector<PersistentManifold> manifolds( count );
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		ContactManifold contact;
+		overlap_sat( bodies[i * 2u], bodies[i * 2u + 1u], contact );
+		store_manifold( manifolds[i], bodies[i * 2u], bodies[i * 2u + 1u], &contact, transforms[i * 2u], transforms[i * 2u + 1u] );
+	}
+
+	const double full = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const PairTransform transform = make_pair_transform( transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		ContactManifold contact;
+		const bool colliding = overlap_sat( bodies[pair * 2u], bodies[pair * 2u + 1u], contact, nullptr, &transform );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	const double refreshed = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		ContactManifold contact;
+		const bool colliding = refresh_manifold( manifolds[pair], bodies[pair * 2u], bodies[pair * 2u + 1u], contact, transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		do_not_optimize( &colliding );
+	}, iterations );
+
+	report( "sat query and clipping", full );
+	report( "reprojected manifold", refreshed );
+	report_speedup( "speedup", full, refreshed );
+}
+
+BENCHMARK( collision, transform_cache )
+{
+	const unsigned count = 256u;
+	const unsigned iterations = 20000u;
+
+	std::vector<RigidBody> bodies = separated_pairs( count );
+
+	// the transformations of the bodies built once per step, the relative one once per pair
+	std::vector<BodyTransform> transforms;
+	for ( const RigidBody& body : bodies )
+		transforms.push_back( make_body_transform( body ) );
+
+	const double matrices = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const mat4 trs = inverse( bodies[pair * 2u + 1u].model() ) * bodies[pair * 2u].model();
+		const mat4 inv_trs = inverse( trs );
+		do_not_optimize( &inv_trs );
+	}, iterations );
+
+	const double affine = time_per_call( [&]( const unsigned i )
+	{
+		const unsigned pair = i % count;
+		const PairTransform transform = make_pair_transform( transforms[pair * 2u], transforms[pair * 2u + 1u] );
+		do_not_optimize( &transform );
+	}, iterations );
+
+	report( "relative 4x4 matrix and inverse", matrices );
+	report( "relative 3x4 transforms from the cache", affine );
+	report_speedup( "speedup", matrices, affine );
+}
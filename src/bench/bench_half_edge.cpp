@@ -0,0 +1,193 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench_half_edge.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include "half_edge.h"
+#include "test_helpers.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+
+BENCHMARK( half_edge, dk_hierarchy )
+{
+	const unsigned count = 1024u;
+	const unsigned iterations = 20000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.0f, 1.0f );
+
+	// random directions, nothing is close to the last query
+	std::vector<vec3> directions;
+	for ( unsigned i = 0u; i < count; i++ )
+		directions.push_back( normalize( vec3( coordinate( generator ), coordinate( generator ), coordinate( generator ) ) ) );
+
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "sphere", "gourd", "bunny" } )
+	{
+		HalfEdgeMesh* mesh = load_mesh( name );
+		mesh->build_hierarchy();
+
+		const unsigned start = mesh->faces()[0]->m_edge->vertex;
+
+		const double bruteforce = time_per_call( [&]( const unsigned i )
+		{
+			const vec3 vertex = mesh->hill_climbing_bruteforce( directions[i % count] );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		const double climbing = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned vertex = mesh->support_vertex( directions[i % count], start );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		const double hierarchy = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned vertex = mesh->hierarchy_support( directions[i % count] );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		const std::string label = std::string( name ) + " " + std::to_string( mesh->vertices().size() ) + " vertices "
+								+ std::to_string( mesh->hierarchy().levels().size() ) + " levels";
+		report( ( label + ", bruteforce" ).c_str(), bruteforce );
+		report( ( label + ", hill climbing" ).c_str(), climbing );
+		report( ( label + ", dk hierarchy" ).c_str(), hierarchy );
+		report_speedup( "speedup over hill climbing", climbing, hierarchy );
+
+		delete mesh;
+	}
+}
+
+BENCHMARK( half_edge, wide_support )
+{
+	const unsigned count = 1024u;
+	const unsigned iterations = 20000u;
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.0f, 1.0f );
+
+	// random directions and a slow sweep, where the last support vertex is a good hint
+	std::vector<vec3> directions;
+	std::vector<vec3> sweep;
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		directions.push_back( normalize( vec3( coordinate( generator ), coordinate( generator ), coordinate( generator ) ) ) );
+		const float angle = i * 0.01f;
+		sweep.push_back( normalize( vec3( std::cos( angle ), 0.3f * std::sin( angle * 0.7f ), std::sin( angle ) ) ) );
+	}
+
+	for ( const char* name : { "octohedron", "cube", "icosahedron", "cylinder", "sphere", "gourd" } )
+	{
+		HalfEdgeMesh* mesh = load_mesh( name );
+
+		const unsigned start = mesh->faces()[0]->m_edge->vertex;
+
+		const double scalar = time_per_call( [&]( const unsigned i )
+		{
+			const vec3 vertex = mesh->hill_climbing_bruteforce( directions[i % count] );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		const double wide = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned vertex = mesh->wide_support( directions[i % count] );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		const double climbing = time_per_call( [&]( const unsigned i )
+		{
+			const unsigned vertex = mesh->support_vertex( directions[i % count], start );
+			do_not_optimize( &vertex );
+		}, iterations );
+
+		unsigned hint = start;
+		const double warm = time_per_call( [&]( const unsigned i )
+		{
+			hint = mesh->support_vertex( sweep[i % count], hint );
+			do_not_optimize( &hint );
+		}, iterations );
+
+		const std::string label = std::string( name ) + " " + std::to_string( mesh->vertices().size() ) + " vertices";
+		report( ( label + ", scalar bruteforce" ).c_str(), scalar );
+		report( ( label + ", " SIMD_NAME " bruteforce" ).c_str(), wide );
+		report( ( label + ", hill climbing" ).c_str(), climbing );
+		report( ( label + ", hill climbing from the last vertex" ).c_str(), warm );
+		report_speedup( "speedup over hill climbing", climbing, wide );
+		report_speedup( "speedup over hill climbing from the last vertex", warm, wide );
+
+		delete mesh;
+	}
+}
+
+BENCHMARK( half_edge, flat_storage )
+{
+	const unsigned iterations = 200u;
+	const unsigned mesh_count = 64u;
+
+	// closed meshes only, every edge has a twin
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "sphere", "gourd" } )
+	{
+		// a scene of many bodies, the face loops of the clipping of all of them do not fit in cache
+		std::vector<HalfEdgeMesh*> meshes;
+		for ( unsigned i = 0u; i < mesh_count; i++ )
+			meshes.push_back( load_mesh( name ) );
+
+		const double linked = time_per_call( [&]( const unsigned )
+		{
+			float sum = 0.0f;
+			for ( const HalfEdgeMesh* mesh : meshes )
+			{
+				const std::vector<vec3>& vertices = mesh->vertices();
+				for ( const HalfEdgeFace* face : mesh->faces() )
+				{
+					const HalfEdge* edge = face->m_edge;
+					do
+					{
+						const HalfEdgeFace* plane = edge->twin->face;
+						sum += dot( plane->m_normal, vertices[plane->m_vertices[0u]] - vertices[edge->vertex] );
+						edge = edge->next;
+					} while ( edge != face->m_edge );
+				}
+			}
+			do_not_optimize( &sum );
+		}, iterations );
+
+		const double flat = time_per_call( [&]( const unsigned )
+		{
+			float sum = 0.0f;
+			for ( const HalfEdgeMesh* mesh : meshes )
+			{
+				const std::vector<vec3>& vertices = mesh->vertices();
+				const std::vector<FlatEdge>& edges = mesh->flat_edges();
+				const std::vector<FlatFace>& faces = mesh->flat_faces();
+				const std::vector<unsigned>& face_vertices = mesh->face_vertices();
+				for ( const FlatFace& face : faces )
+				{
+					unsigned edge = face.edge;
+					do
+					{
+						const FlatFace& plane = faces[edges[edges[edge].twin].face];
+						sum += dot( plane.normal, vertices[face_vertices[plane.first_vertex]] - vertices[edges[edge].vertex] );
+						edge = edges[edge].next;
+					} while ( edge != face.edge );
+				}
+			}
+			do_not_optimize( &sum );
+		}, iterations );
+
+		const std::string label = std::to_string( mesh_count ) + " " + name + " " + std::to_string( meshes[0]->flat_edges().size() ) + " edges";
+		report( ( label + ", linked faces" ).c_str(), linked );
+		report( ( label + ", flat arrays" ).c_str(), flat );
+		report_speedup( "speedup over linked faces", linked, flat );
+
+		for ( HalfEdgeMesh* mesh : meshes )
+			delete mesh;
+	}
+}
@@ -0,0 +1,67 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench_rigid_body.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include "rigid_body.h"
+
+#include <random>
+
+/**
+* @brief dynamic bodies with random orientations and a non uniform inertia
+*/
+static std::vector<RigidBody> random_bodies( const unsigned count )
+{
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+
+	std::vector<RigidBody> bodies( count );
+	for ( RigidBody& body : bodies )
+	{
+		body.mass = 1.0f;
+		body.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		body.set_inertia( mat3( 1.0f / 6.0f, 0.0f, 0.0f,
+								0.0f, 1.0f / 3.0f, 0.0f,
+								0.0f, 0.0f, 1.0f / 4.0f ) );
+	}
+
+	return bodies;
+}
+
+BENCHMARK( rigid_body, apply_impulse )
+{
+	const unsigned count = 256u;
+	const unsigned iterations = 1000000u;
+
+	std::vector<RigidBody> bodies = random_bodies( count );
+
+	const vec3 point( 0.3f, 0.5f, -0.2f );
+	const vec3 impulse( 0.01f, -0.02f, 0.005f );
+
+	// the world inertia built from the orientation on every impulse
+	const double before = time_per_call( [&]( const unsigned i )
+	{
+		RigidBody& body = bodies[i % count];
+		body.update_world_inertia();
+		body.apply_impulse( body.position + point, impulse );
+		do_not_optimize( &body );
+	}, iterations );
+
+	// the world inertia cached once per step
+	const double after = time_per_call( [&]( const unsigned i )
+	{
+		RigidBody& body = bodies[i % count];
+		body.apply_impulse( body.position + point, impulse );
+		do_not_optimize( &body );
+	}, iterations );
+
+	report( "recomputed world inertia", before );
+	report( "cached world inertia", after );
+	report_speedup( "speedup", before, after );
+}
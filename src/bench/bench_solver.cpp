@@ -0,0 +1,109 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: bench_solver.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include "solver.h"
+#include "rigid_body.h"
+#include "test_helpers.h"
+
+#include <string>
+
+BENCHMARK( solver, colored )
+{
+	// 12000 manifolds, 48000 contact points
+	const unsigned columns = 1200u;
+	const unsigned height = 10u;
+	const unsigned iterations = 20u;
+
+	std::vector<RigidBody> bodies;
+	std::vector<ContactManifold> contacts;
+	make_stacks( bodies, contacts, columns, height );
+
+	// the bodies change on every solve, the contacts are copied so every solve starts the same
+	auto solve = [&]( SolverConstraint& solver )
+	{
+		return time_per_call( [&]( const unsigned )
+		{
+			std::vector<ContactManifold> step = contacts;
+			solver.solve_collision( step, 1.0f / 60.0f );
+			do_not_optimize( step.data() );
+		}, iterations );
+	};
+
+	SolverConstraint sequential;
+	sequential.set_iteration_count( 10 );
+	sequential.set_baumgarte( 0.2f );
+	sequential.set_mode( SolverMode::Sequential );
+	const double before = solve( sequential );
+	report( "sequential", before );
+
+	const unsigned max_threads = std::thread::hardware_concurrency() > 8u ? std::thread::hardware_concurrency() : 8u;
+	for ( unsigned threads = 1u; threads <= max_threads; threads *= 2u )
+	{
+		ThreadPool pool( threads );
+
+		SolverConstraint colored;
+		colored.set_iteration_count( 10 );
+		colored.set_baumgarte( 0.2f );
+		colored.set_mode( SolverMode::Colored );
+		colored.set_thread_pool( &pool );
+		const double after = solve( colored );
+
+		const std::string label = "colored " + std::to_string( threads ) + " threads";
+		report( label.c_str(), after );
+		report_speedup( "speedup", before, after );
+	}
+}
+
+BENCHMARK( solver, wide )
+{
+	const unsigned columns = 1200u;
+	const unsigned height = 10u;
+	const unsigned iterations = 20u;
+
+	std::vector<RigidBody> bodies;
+	std::vector<ContactManifold> contacts;
+	make_stacks( bodies, contacts, columns, height );
+
+	auto solve = [&]( const SolverMode mode, const int solver_iterations )
+	{
+		SolverConstraint solver;
+		solver.set_iteration_count( solver_iterations );
+		solver.set_baumgarte( 0.2f );
+		solver.set_mode( mode );
+
+		return time_per_call( [&]( const unsigned )
+		{
+			std::vector<ContactManifold> step = contacts;
+			solver.solve_collision( step, 1.0f / 60.0f );
+			do_not_optimize( step.data() );
+		}, iterations );
+	};
+
+	// both in a single thread, the wide mode pays the packing of the rows once per step
+	for ( const int solver_iterations : { 4, 10, 20 } )
+	{
+		const double before = solve( SolverMode::Colored, solver_iterations );
+		const double after = solve( SolverMode::Wide, solver_iterations );
+
+		const std::string label = std::to_string( solver_iterations ) + " iterations ";
+		report( ( label + "colored scalar" ).c_str(), before );
+		report( ( label + "colored " SIMD_NAME ).c_str(), after );
+		report_speedup( "speedup", before, after );
+	}
+
+	// cost of a single iteration
+	const double scalar = ( solve( SolverMode::Colored, 21 ) - solve( SolverMode::Colored, 1 ) ) / 20.0;
+	const double wide = ( solve( SolverMode::Wide, 21 ) - solve( SolverMode::Wide, 1 ) ) / 20.0;
+
+	report( "iteration colored scalar", scalar );
+	report( "iteration colored " SIMD_NAME, wide );
+	report_speedup( "speedup", scalar, wide );
+}
@@ -10,6 +10,7 @@ Creation date: 01/28/2020
 #include "editor.h"
 
 #include "graphics.h"
+#include "profiler.h"
 
 #include <imgui/imgui.h>
 #include <imgui/imgui_internal.h>
@@ -47,7 +48,7 @@ void Editor::initialize()
 
 	// load first scene
 	m_selected_scene = 0;
-	m_scene.load_scene( m_scene_files[m_selected_scene].c_str() );
+	load_scene();
 }
 
 /**
@@ -86,6 +87,7 @@ void Editor::update()
 	}
 
 	Physics::get_instance().show_in_editor();
+	Profiler::get_instance().show_in_editor();
 }
 
 /**
@@ -113,5 +115,23 @@ void Editor::render()
 void Editor::reload()
 {
 	Physics::get_instance().clear();
+	load_scene();
+}
+
+/**
+* @brief load the selected scene and its camera
+*/
+void Editor::load_scene()
+{
 	m_scene.load_scene( m_scene_files[m_selected_scene].c_str() );
+
+	if ( m_scene.has_camera() )
+	{
+		Camera camera;
+		camera.set_position( m_scene.camera().position );
+		camera.set_view( m_scene.camera().view );
+		camera.set_up( m_scene.camera().up );
+		camera.initialize();
+		Graphics::get_instance().set_camera( camera );
+	}
 }
@@ -27,7 +27,8 @@ public:
 	void render		();
 
 private:
-	void reload();
+	void reload		();
+	void load_scene	();
 
 private:
 	Scene m_scene;
@@ -0,0 +1,243 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: profiler.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "profiler.h"
+
+#include <fstream>
+
+
+/**
+* @brief get the name of a phase
+* @param phase
+* @return name
+*/
+const char* phase_name( const ProfilePhase phase )
+{
+	switch ( phase )
+	{
+	case ProfilePhase::Step:		return "Step";
+	case ProfilePhase::Broadphase:	return "Broadphase";
+	case ProfilePhase::SatCache:	return "SAT Cached Axis";
+	case ProfilePhase::SatFaces:	return "SAT Faces";
+	case ProfilePhase::SatEdges:	return "SAT Edges";
+	case ProfilePhase::Gjk:			return "GJK";
+	case ProfilePhase::Epa:			return "EPA";
+	case ProfilePhase::Shapes:		return "Shape Routines";
+	case ProfilePhase::Clipping:	return "Manifold Clipping";
+	case ProfilePhase::Solver:		return "Solver";
+	case ProfilePhase::Integration:	return "Integration";
+	default:						return "Unknown";
+	}
+}
+
+/**
+* @brief get the name of a counter
+* @param counter
+* @return name
+*/
+const char* counter_name( const ProfileCounter counter )
+{
+	switch ( counter )
+	{
+	case ProfileCounter::SupportQueries:	return "Support Queries";
+	case ProfileCounter::SupportSteps:		return "Support Steps";
+	case ProfileCounter::RefreshedManifolds:	return "Refreshed Manifolds";
+	case ProfileCounter::DroppedContacts:		return "Dropped Contacts";
+	default:								return "Unknown";
+	}
+}
+
+/**
+* @brief create the profiler, times are measured from here
+*/
+Profiler::Profiler() : m_epoch( std::chrono::steady_clock::now() ), m_history( history_size )
+{
+}
+
+/**
+* @brief get instance of the singleton
+* @return instance
+*/
+Profiler& Profiler::get_instance()
+{
+	static Profiler instance{};
+	return instance;
+}
+
+/**
+* @brief close the current frame, keeping it for the averages and the capture
+*/
+void Profiler::end_frame()
+{
+	m_last = m_current;
+	m_current = ProfileFrame();
+
+	m_history[m_history_next] = m_last;
+	m_history_next = ( m_history_next + 1u ) % history_size;
+
+	// average of the last frames
+	m_average = ProfileFrame();
+	for ( const ProfileFrame& frame : m_history )
+	{
+		for ( unsigned i = 0u; i < static_cast<unsigned>( ProfilePhase::Count ); i++ )
+		{
+			m_average.nanoseconds[i] += frame.nanoseconds[i];
+			m_average.calls[i] += frame.calls[i];
+		}
+		for ( unsigned i = 0u; i < static_cast<unsigned>( ProfileCounter::Count ); i++ )
+			m_average.counters[i] += frame.counters[i];
+	}
+	for ( unsigned i = 0u; i < static_cast<unsigned>( ProfilePhase::Count ); i++ )
+	{
+		m_average.nanoseconds[i] /= history_size;
+		m_average.calls[i] /= history_size;
+	}
+	for ( unsigned i = 0u; i < static_cast<unsigned>( ProfileCounter::Count ); i++ )
+		m_average.counters[i] /= history_size;
+
+	if ( m_capture_frames > 0u && --m_capture_frames == 0u )
+		export_trace( m_capture_file );
+}
+
+/**
+* @brief add a timed scope to the current frame
+* @param phase
+* @param start	nanoseconds since the profiler was created
+* @param end
+*/
+void Profiler::record( const ProfilePhase phase, const long long start, const long long end )
+{
+	const unsigned index = static_cast<unsigned>( phase );
+	m_current.nanoseconds[index] += end - start;
+	m_current.calls[index]++;
+
+	// every scope is only kept while capturing
+	if ( m_capture_frames > 0u )
+		m_events.push_back( ProfileEvent{ phase, start, end } );
+}
+
+/**
+* @brief add to a counter of the current frame
+* @param counter
+* @param amount
+*/
+void Profiler::count( const ProfileCounter counter, const unsigned amount )
+{
+	m_current.counters[static_cast<unsigned>( counter )] += amount;
+}
+
+/**
+* @brief record every scope of the next frames, then export them as a trace
+* @param frames
+* @param filename
+*/
+void Profiler::capture( const unsigned frames, const std::string& filename )
+{
+	m_events.clear();
+	m_capture_frames = frames;
+	m_capture_file = filename;
+}
+
+/**
+* @brief	write the last capture as a Chrome trace (chrome://tracing or ui.perfetto.dev),
+*			nested scopes show as nested slices
+* @param filename
+* @return the file could be written
+*/
+bool Profiler::export_trace( const std::string& filename ) const
+{
+	std::ofstream file( filename );
+	if ( file.is_open() == false )
+		return false;
+
+	file << "{\"traceEvents\":[\n";
+	for ( unsigned i = 0u; i < m_events.size(); i++ )
+	{
+		const ProfileEvent& event = m_events[i];
+
+		// complete events, in microseconds
+		file << "{\"name\":\"" << phase_name( event.phase ) << "\",\"cat\":\"physics\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+			 << ",\"ts\":" << event.start / 1000.0
+			 << ",\"dur\":" << ( event.end - event.start ) / 1000.0 << "}"
+			 << ( i + 1u < m_events.size() ? ",\n" : "\n" );
+	}
+	file << "],\"displayTimeUnit\":\"ms\"}\n";
+
+	return file.good();
+}
+
+/**
+* @brief get the times of the last frame
+* @return frame
+*/
+const ProfileFrame& Profiler::last_frame() const
+{
+	return m_last;
+}
+
+/**
+* @brief get the average times of the last history_size frames
+* @return frame
+*/
+const ProfileFrame& Profiler::average() const
+{
+	return m_average;
+}
+
+/**
+* @brief check if a capture is running
+* @return capturing
+*/
+bool Profiler::capturing() const
+{
+	return m_capture_frames > 0u;
+}
+
+/**
+* @brief get the current time
+* @return nanoseconds since the profiler was created
+*/
+long long Profiler::now() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_epoch ).count();
+}
+
+/**
+* @brief start timing a phase
+* @param phase
+*/
+ProfileScope::ProfileScope( const ProfilePhase phase ) : m_phase( phase ), m_start( Profiler::get_instance().now() )
+{
+}
+
+/**
+* @brief record the time since the construction
+*/
+ProfileScope::~ProfileScope()
+{
+	Profiler& profiler = Profiler::get_instance();
+	profiler.record( m_phase, m_start, profiler.now() );
+}
+
+/**
+* @brief start timing a step
+*/
+ProfileFrameScope::ProfileFrameScope() : m_start( Profiler::get_instance().now() )
+{
+}
+
+/**
+* @brief record the step and close the frame
+*/
+ProfileFrameScope::~ProfileFrameScope()
+{
+	Profiler& profiler = Profiler::get_instance();
+	profiler.record( ProfilePhase::Step, m_start, profiler.now() );
+	profiler.end_frame();
+}
@@ -0,0 +1,146 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: profiler.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// set by the PROFILER option of CMakeLists.txt, with 0 the timers compile to nothing
+#ifndef PROFILER_ENABLED
+	#define PROFILER_ENABLED 1
+#endif
+
+enum class ProfilePhase
+{
+	Step,
+	Broadphase,
+	SatCache,
+	SatFaces,
+	SatEdges,
+	Gjk,
+	Epa,
+	Shapes,
+	Clipping,
+	Solver,
+	Integration,
+	Count
+};
+
+// amounts counted during a frame
+enum class ProfileCounter
+{
+	SupportQueries,		// hill climbings of the SAT face query
+	SupportSteps,		// moves to a neighbor vertex in those hill climbings
+	RefreshedManifolds,	// contact manifolds reprojected instead of running the narrowphase
+	DroppedContacts,	// contact points removed by the manifold reduction
+	Count
+};
+
+const char* phase_name( const ProfilePhase phase );
+const char* counter_name( const ProfileCounter counter );
+
+// time spent in every phase during a frame
+struct ProfileFrame
+{
+	long long	nanoseconds[static_cast<unsigned>( ProfilePhase::Count )]{};
+	unsigned	calls[static_cast<unsigned>( ProfilePhase::Count )]{};
+	unsigned	counters[static_cast<unsigned>( ProfileCounter::Count )]{};
+};
+
+// a timed scope, in nanoseconds since the profiler was created
+struct ProfileEvent
+{
+	ProfilePhase phase;
+	long long	 start;
+	long long	 end;
+};
+
+// only the main thread records
+class Profiler
+{
+private:
+	Profiler();
+
+public:
+	static Profiler& get_instance();
+
+	void end_frame	();
+	void record		( const ProfilePhase phase, const long long start, const long long end );
+	void count		( const ProfileCounter counter, const unsigned amount );
+
+	void capture		( const unsigned frames, const std::string& filename );
+	bool export_trace	( const std::string& filename ) const;
+
+	const ProfileFrame& last_frame() const;
+	const ProfileFrame& average() const;
+	bool				capturing() const;
+
+	long long now() const;
+
+	// profiler_editor.cpp
+	void show_in_editor();
+
+public:
+	static const unsigned history_size = 120u;	// frames kept for the averages and the plot
+
+private:
+	std::chrono::steady_clock::time_point m_epoch;
+
+	ProfileFrame				m_current;
+	ProfileFrame				m_last;
+	ProfileFrame				m_average;
+	std::vector<ProfileFrame>	m_history;		// ring of the last frames
+	unsigned					m_history_next{ 0u };
+
+	// trace being captured
+	std::vector<ProfileEvent>	m_events;
+	unsigned					m_capture_frames{ 0u };
+	std::string					m_capture_file;
+	std::string					m_last_export;
+	int							m_frames_to_capture{ 60 };
+};
+
+// records the time between its construction and its destruction
+class ProfileScope
+{
+public:
+	explicit ProfileScope( const ProfilePhase phase );
+	~ProfileScope();
+
+private:
+	ProfilePhase	m_phase;
+	long long		m_start;
+};
+
+// a physics step, records the whole step and closes the frame
+class ProfileFrameScope
+{
+public:
+	ProfileFrameScope();
+	~ProfileFrameScope();
+
+private:
+	long long m_start;
+};
+
+
+#define PROFILE_CONCAT_IMPL( a, b ) a##b
+#define PROFILE_CONCAT( a, b ) PROFILE_CONCAT_IMPL( a, b )
+
+#if PROFILER_ENABLED
+	#define PROFILE_SCOPE( phase )	ProfileScope PROFILE_CONCAT( profile_scope_, __LINE__ )( phase )
+	#define PROFILE_FRAME()			ProfileFrameScope PROFILE_CONCAT( profile_frame_, __LINE__ )
+	#define PROFILE_COUNT( counter, amount )	Profiler::get_instance().count( counter, amount )
+#else
+	#define PROFILE_SCOPE( phase )
+	#define PROFILE_FRAME()
+	#define PROFILE_COUNT( counter, amount )
+#endif
@@ -0,0 +1,81 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: profiler_editor.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "profiler.h"
+
+#include <imgui/imgui.h>
+
+#include <cfloat>
+
+// profiler window, not part of the headless build
+
+/**
+* @brief show the times of the phases
+*/
+void Profiler::show_in_editor()
+{
+	ImGui::Begin( "Profiler" );
+	{
+#if PROFILER_ENABLED
+		const float step = static_cast<float>( m_average.nanoseconds[static_cast<unsigned>( ProfilePhase::Step )] );
+
+		ImGui::Columns( 5, "phases" );
+		ImGui::Text( "Phase" );		ImGui::NextColumn();
+		ImGui::Text( "Last ms" );	ImGui::NextColumn();
+		ImGui::Text( "Avg ms" );	ImGui::NextColumn();
+		ImGui::Text( "Calls" );		ImGui::NextColumn();
+		ImGui::Text( "Step %%" );	ImGui::NextColumn();
+		ImGui::Separator();
+
+		for ( unsigned i = 0u; i < static_cast<unsigned>( ProfilePhase::Count ); i++ )
+		{
+			ImGui::Text( "%s", phase_name( static_cast<ProfilePhase>( i ) ) );	ImGui::NextColumn();
+			ImGui::Text( "%.3f", m_last.nanoseconds[i] / 1e6f );				ImGui::NextColumn();
+			ImGui::Text( "%.3f", m_average.nanoseconds[i] / 1e6f );				ImGui::NextColumn();
+			ImGui::Text( "%u", m_last.calls[i] );								ImGui::NextColumn();
+			ImGui::Text( "%.1f", step > 0.0f ? 100.0f * m_average.nanoseconds[i] / step : 0.0f );
+			ImGui::NextColumn();
+		}
+		ImGui::Columns( 1 );
+		ImGui::Separator();
+
+		for ( unsigned i = 0u; i < static_cast<unsigned>( ProfileCounter::Count ); i++ )
+			ImGui::Text( "%s: %u (avg %u)", counter_name( static_cast<ProfileCounter>( i ) ), m_last.counters[i], m_average.counters[i] );
+
+		const unsigned queries = m_average.counters[static_cast<unsigned>( ProfileCounter::SupportQueries )];
+		const unsigned steps = m_average.counters[static_cast<unsigned>( ProfileCounter::SupportSteps )];
+		ImGui::Text( "Steps per support query: %.2f", queries > 0u ? static_cast<float>( steps ) / queries : 0.0f );
+		ImGui::Separator();
+
+		// step times, oldest first
+		float times[history_size];
+		for ( unsigned i = 0u; i < history_size; i++ )
+			times[i] = m_history[( m_history_next + i ) % history_size].nanoseconds[static_cast<unsigned>( ProfilePhase::Step )] / 1e6f;
+		ImGui::PlotLines( "Step ms", times, history_size, 0, nullptr, 0.0f, FLT_MAX, ImVec2( 0.0f, 60.0f ) );
+
+		// trace
+		ImGui::SliderInt( "Frames", &m_frames_to_capture, 1, 600 );
+		if ( capturing() )
+		{
+			ImGui::Text( "Capturing... %u frames left", m_capture_frames );
+		}
+		else if ( ImGui::Button( "Capture Trace" ) )
+		{
+			capture( static_cast<unsigned>( m_frames_to_capture ), "physics_trace.json" );
+			m_last_export = "physics_trace.json";
+		}
+
+		if ( m_last_export.empty() == false && capturing() == false )
+			ImGui::Text( "Saved %s (open in chrome://tracing)", m_last_export.c_str() );
+#else
+		ImGui::Text( "Compiled without the profiler (PROFILER option)" );
+#endif
+	}
+	ImGui::End();
+}
@@ -10,7 +10,7 @@ Creation date: 02/22/2020
 #include "scene.h"
 
 #include "physics.h"
-#include "graphics.h"
+#include "sphere_collision.h"
 
 #include <fstream>
 #include <iostream>
@@ -35,11 +35,13 @@ Scene::Scene( const char* filename )
 /**
 * @brief load the scene from a file
 * @param filename
+* @return the file could be opened
 */
-void Scene::load_scene( const char* filename )
+bool Scene::load_scene( const char* filename )
 {
 	// clear data if any
 	clear();
+	m_has_camera = false;
 
 	std::ifstream file;
 	file.open( filename );
@@ -47,7 +49,7 @@ void Scene::load_scene( const char* filename )
 	if ( !file )
 	{
 		std::cout << "couldn't open file " << filename << std::endl;
-		return;
+		return false;
 	}
 
 	// copy the file stream to the stream buffer
@@ -66,6 +68,26 @@ void Scene::load_scene( const char* filename )
 		// proccess the line
 		read_line( file_data );
 	}
+
+	return true;
+}
+
+/**
+* @brief check if the scene file had a camera
+* @return has camera
+*/
+bool Scene::has_camera() const
+{
+	return m_has_camera;
+}
+
+/**
+* @brief get the camera of the scene file
+* @return camera
+*/
+const SceneCamera& Scene::camera() const
+{
+	return m_camera;
 }
 
 /**
@@ -122,15 +144,20 @@ void Scene::read_line( std::string& line )
 		return;
 	}
 
+	// read capsule
+	else if ( line.rfind( "CAPSULE", 0u ) == 0u )
+	{
+		add_capsule( line );
+		return;
+	}
+
 	// read camera
 	else if ( line.rfind( "CAMERA", 0u ) == 0u )
 	{
-		Camera camera;
-		camera.set_position( read_vector( line ) );
-		camera.set_view( read_vector( line ) );
-		camera.set_up( read_vector( line ) );
-		camera.initialize();
-		Graphics::get_instance().set_camera( camera );
+		m_camera.position = read_vector( line );
+		m_camera.view = read_vector( line );
+		m_camera.up = read_vector( line );
+		m_has_camera = true;
 		return;
 	}
 	// empty lines
@@ -230,20 +257,10 @@ void Scene::add_cube( std::string& data )
 {
 	RigidBody body = read_body( data );
 	body.mesh = Physics::get_instance().meshes()[0u];
+	body.shape = ShapeType::Box;
 
-	//body.I_body = mat3( 0.0f );
-	body.I_body = body.mesh->compute_intertia_tensor();
-						/*mat3( 0.5f, 0.0f,  0.0f,
-						0.0f, 0.25f, 0.0f,
-						0.0f, 0.0f,  0.5f );*/
-	
 	/* change intertia tensor I_new = Iold * ( mass_new / mass_old ) */
-	body.I_body *= 1.0f * body.inv_mass();
-
-	if ( body.I_body == mat3( 0.0f ) )
-		body.I_inv_body = mat3( 0.0f );
-	else
-		body.I_inv_body = inverse( body.I_body );
+	body.set_inertia( body.mesh->compute_intertia_tensor() * body.inv_mass() );
 
 	Physics::get_instance().add_body( body );
 }
@@ -256,11 +273,9 @@ void Scene::add_cylinder( std::string& data )
 	RigidBody body = read_body( data );
 	body.mesh = Physics::get_instance().meshes()[1u];
 
-	body.I_body = mat3( 1.0f / 6.0f, 0.0f,		  0.0f,
-						0.0f,		 1.0f / 6.0f, 0.0f,
-						0.0f,		 0.0f,		  1.0f / 6.0f );
-
-	body.I_inv_body = inverse( body.I_body );
+	body.set_inertia( mat3( 1.0f / 6.0f, 0.0f,		 0.0f,
+							0.0f,		 1.0f / 6.0f, 0.0f,
+							0.0f,		 0.0f,		  1.0f / 6.0f ) );
 
 	Physics::get_instance().add_body( body );
 }
@@ -274,11 +289,9 @@ void Scene::add_icosahedron( std::string& data )
 	body.mesh = Physics::get_instance().meshes()[2u];
 
 	const float I = glm::pi<float>() / 15.0f;
-	body.I_body = mat3( I,	  0.0f, 0.0f,
-						0.0f, I,	0.0f,
-						0.0f, 0.0f, I );
-
-	body.I_inv_body = inverse( body.I_body );
+	body.set_inertia( mat3( I,	  0.0f, 0.0f,
+							0.0f, I,	0.0f,
+							0.0f, 0.0f, I ) );
 
 	Physics::get_instance().add_body( body );
 }
@@ -292,29 +305,38 @@ void Scene::add_octohedron( std::string& data )
 	body.mesh = Physics::get_instance().meshes()[3u];
 
 	const float I = glm::pi<float>() / 15.0f;
-	body.I_body = mat3( I,	  0.0f, 0.0f,
-						0.0f, I,	0.0f,
-						0.0f, 0.0f, I );
-
-	body.I_inv_body = inverse( body.I_body );
+	body.set_inertia( mat3( I,	  0.0f, 0.0f,
+							0.0f, I,	0.0f,
+							0.0f, 0.0f, I ) );
 
 	Physics::get_instance().add_body( body );
 }
 
 /**
-* @brief add a sphere rigid body
+* @brief add a sphere rigid body, its mesh is only drawn
 */
 void Scene::add_sphere( std::string& data )
 {
 	RigidBody body = read_body( data );
 	body.mesh = Physics::get_instance().meshes()[4u];
+	body.shape = ShapeType::Sphere;
 
-	const float I = glm::pi<float>() / 15.0f;
-	body.I_body = mat3( I,	  0.0f, 0.0f,
-						0.0f, I,	0.0f,
-						0.0f, 0.0f, I );
+	body.set_inertia( sphere_inertia_tensor( body.mass, make_sphere( body, make_body_transform( body ) ).radius ) );
+
+	Physics::get_instance().add_body( body );
+}
+
+/**
+* @brief add a capsule rigid body along its y axis, the x scale is the diameter
+*/
+void Scene::add_capsule( std::string& data )
+{
+	RigidBody body = read_body( data );
+	body.mesh = Physics::get_instance().meshes()[5u];
+	body.shape = ShapeType::Capsule;
 
-	body.I_inv_body = inverse( body.I_body );
+	const Capsule capsule = make_capsule( body, make_body_transform( body ) );
+	body.set_inertia( capsule_inertia_tensor( body.mass, capsule.radius, glm::length( capsule.end - capsule.start ) * 0.5f ) );
 
 	Physics::get_instance().add_body( body );
 }
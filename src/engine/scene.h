@@ -9,13 +9,20 @@ Creation date: 02/22/2020
 ----------------------------------------------------------------------------------------------------------*/
 #pragma once
 
-#include "camera.h"
 #include "rigid_body.h"
 
 #include "math_utils.h"
 
 #include <string>
 
+// camera of the scene file, applied by the editor
+struct SceneCamera
+{
+	vec3 position;
+	vec3 view;
+	vec3 up;
+};
+
 class Scene
 {
 public:		// LOADING - UNLOADING
@@ -24,7 +31,11 @@ public:		// LOADING - UNLOADING
 	void clear();
 
 	Scene( const char* filename );
-	void load_scene( const char* filename );
+	bool load_scene( const char* filename );
+
+public:		// GET
+	bool				has_camera() const;
+	const SceneCamera&	camera() const;
 
 private:	// PARSER
 	void		read_line	( std::string& line );
@@ -39,4 +50,9 @@ private:	// SHAPE SPECIFICS
 	void add_icosahedron ( std::string& data );
 	void add_octohedron	 ( std::string& data );
 	void add_sphere		 ( std::string& data );
+	void add_capsule	 ( std::string& data );
+
+private:	// MEMBERS
+	SceneCamera m_camera;
+	bool		m_has_camera{ false };
 };
\ No newline at end of file
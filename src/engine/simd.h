@@ -0,0 +1,138 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: simd.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cmath>
+
+// widest instruction set enabled by the compiler flags (see SSE_FLAGS in CMakeLists.txt)
+#if defined( __AVX__ )
+	#define SIMD_AVX 1
+	#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#define SIMD_SSE 1
+	#include <emmintrin.h>
+#endif
+
+// floats processed by a single instruction
+#if defined( SIMD_AVX )
+	const unsigned simd_width = 8u;
+#else
+	const unsigned simd_width = 4u;
+#endif
+
+// name of the instruction set, for the editor and the benchmarks
+#if defined( SIMD_AVX )
+	#define SIMD_NAME "AVX"
+#elif defined( SIMD_SSE )
+	#define SIMD_NAME "SSE"
+#else
+	#define SIMD_NAME "Scalar"
+#endif
+
+// simd_width floats, one per lane
+struct WideFloat
+{
+#if defined( SIMD_AVX )
+	__m256 v;
+#elif defined( SIMD_SSE )
+	__m128 v;
+#else
+	float v[simd_width];
+#endif
+};
+
+#if defined( SIMD_AVX )
+
+inline WideFloat wide_set	( const float a )						{ return { _mm256_set1_ps( a ) }; }
+inline WideFloat wide_load	( const float* p )						{ return { _mm256_load_ps( p ) }; }
+inline void		 wide_store	( float* p, const WideFloat a )			{ _mm256_store_ps( p, a.v ); }
+inline WideFloat operator+	( const WideFloat a, const WideFloat b ){ return { _mm256_add_ps( a.v, b.v ) }; }
+inline WideFloat operator-	( const WideFloat a, const WideFloat b ){ return { _mm256_sub_ps( a.v, b.v ) }; }
+inline WideFloat operator*	( const WideFloat a, const WideFloat b ){ return { _mm256_mul_ps( a.v, b.v ) }; }
+inline WideFloat wide_min	( const WideFloat a, const WideFloat b ){ return { _mm256_min_ps( a.v, b.v ) }; }
+inline WideFloat wide_max	( const WideFloat a, const WideFloat b ){ return { _mm256_max_ps( a.v, b.v ) }; }
+inline WideFloat operator/	( const WideFloat a, const WideFloat b ){ return { _mm256_div_ps( a.v, b.v ) }; }
+inline WideFloat wide_sqrt	( const WideFloat a )					{ return { _mm256_sqrt_ps( a.v ) }; }
+
+// masks, every bit of a lane set when the comparison holds
+inline WideFloat wide_less		( const WideFloat a, const WideFloat b )					{ return { _mm256_cmp_ps( a.v, b.v, _CMP_LT_OQ ) }; }
+inline WideFloat wide_greater	( const WideFloat a, const WideFloat b )					{ return { _mm256_cmp_ps( a.v, b.v, _CMP_GT_OQ ) }; }
+inline WideFloat wide_and		( const WideFloat a, const WideFloat b )					{ return { _mm256_and_ps( a.v, b.v ) }; }
+inline WideFloat wide_select	( const WideFloat mask, const WideFloat a, const WideFloat b )	{ return { _mm256_blendv_ps( b.v, a.v, mask.v ) }; }
+inline unsigned	 wide_mask_bits	( const WideFloat mask )									{ return static_cast<unsigned>( _mm256_movemask_ps( mask.v ) ); }
+
+#elif defined( SIMD_SSE )
+
+inline WideFloat wide_set	( const float a )						{ return { _mm_set1_ps( a ) }; }
+inline WideFloat wide_load	( const float* p )						{ return { _mm_load_ps( p ) }; }
+inline void		 wide_store	( float* p, const WideFloat a )			{ _mm_store_ps( p, a.v ); }
+inline WideFloat operator+	( const WideFloat a, const WideFloat b ){ return { _mm_add_ps( a.v, b.v ) }; }
+inline WideFloat operator-	( const WideFloat a, const WideFloat b ){ return { _mm_sub_ps( a.v, b.v ) }; }
+inline WideFloat operator*	( const WideFloat a, const WideFloat b ){ return { _mm_mul_ps( a.v, b.v ) }; }
+inline WideFloat wide_min	( const WideFloat a, const WideFloat b ){ return { _mm_min_ps( a.v, b.v ) }; }
+inline WideFloat wide_max	( const WideFloat a, const WideFloat b ){ return { _mm_max_ps( a.v, b.v ) }; }
+inline WideFloat operator/	( const WideFloat a, const WideFloat b ){ return { _mm_div_ps( a.v, b.v ) }; }
+inline WideFloat wide_sqrt	( const WideFloat a )					{ return { _mm_sqrt_ps( a.v ) }; }
+
+// masks, every bit of a lane set when the comparison holds
+inline WideFloat wide_less		( const WideFloat a, const WideFloat b )					{ return { _mm_cmplt_ps( a.v, b.v ) }; }
+inline WideFloat wide_greater	( const WideFloat a, const WideFloat b )					{ return { _mm_cmpgt_ps( a.v, b.v ) }; }
+inline WideFloat wide_and		( const WideFloat a, const WideFloat b )					{ return { _mm_and_ps( a.v, b.v ) }; }
+inline WideFloat wide_select	( const WideFloat mask, const WideFloat a, const WideFloat b )	{ return { _mm_or_ps( _mm_and_ps( mask.v, a.v ), _mm_andnot_ps( mask.v, b.v ) ) }; }
+inline unsigned	 wide_mask_bits	( const WideFloat mask )									{ return static_cast<unsigned>( _mm_movemask_ps( mask.v ) ); }
+
+#else
+
+// plain loops the compiler may still vectorize
+#define WIDE_LOOP( expression ) WideFloat r; for ( unsigned i = 0u; i < simd_width; i++ ) r.v[i] = expression; return r;
+
+inline WideFloat wide_set	( const float a )						{ WIDE_LOOP( a ) }
+inline WideFloat wide_load	( const float* p )						{ WIDE_LOOP( p[i] ) }
+inline void		 wide_store	( float* p, const WideFloat a )			{ for ( unsigned i = 0u; i < simd_width; i++ ) p[i] = a.v[i]; }
+inline WideFloat operator+	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] + b.v[i] ) }
+inline WideFloat operator-	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] - b.v[i] ) }
+inline WideFloat operator*	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] * b.v[i] ) }
+inline WideFloat wide_min	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] < b.v[i] ? a.v[i] : b.v[i] ) }
+inline WideFloat wide_max	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] > b.v[i] ? a.v[i] : b.v[i] ) }
+inline WideFloat operator/	( const WideFloat a, const WideFloat b ){ WIDE_LOOP( a.v[i] / b.v[i] ) }
+inline WideFloat wide_sqrt	( const WideFloat a )					{ WIDE_LOOP( std::sqrt( a.v[i] ) ) }
+
+// masks, 1 in the lanes where the comparison holds
+inline WideFloat wide_less		( const WideFloat a, const WideFloat b )					{ WIDE_LOOP( a.v[i] < b.v[i] ? 1.0f : 0.0f ) }
+inline WideFloat wide_greater	( const WideFloat a, const WideFloat b )					{ WIDE_LOOP( a.v[i] > b.v[i] ? 1.0f : 0.0f ) }
+inline WideFloat wide_and		( const WideFloat a, const WideFloat b )					{ WIDE_LOOP( a.v[i] * b.v[i] ) }
+inline WideFloat wide_select	( const WideFloat mask, const WideFloat a, const WideFloat b )	{ WIDE_LOOP( mask.v[i] != 0.0f ? a.v[i] : b.v[i] ) }
+inline unsigned	 wide_mask_bits	( const WideFloat mask )
+{
+	unsigned bits = 0u;
+	for ( unsigned i = 0u; i < simd_width; i++ )
+		bits |= mask.v[i] != 0.0f ? 1u << i : 0u;
+	return bits;
+}
+
+#undef WIDE_LOOP
+
+#endif
+
+inline WideFloat operator-( const WideFloat a ) { return wide_set( 0.0f ) - a; }
+
+// vec3 with a lane per component array
+struct WideVec3
+{
+	WideFloat x;
+	WideFloat y;
+	WideFloat z;
+};
+
+inline WideVec3  operator+	( const WideVec3& a, const WideVec3& b )	{ return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+inline WideVec3  operator-	( const WideVec3& a, const WideVec3& b )	{ return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+inline WideVec3  operator*	( const WideVec3& a, const WideFloat b )	{ return { a.x * b, a.y * b, a.z * b }; }
+inline WideFloat wide_dot	( const WideVec3& a, const WideVec3& b )	{ return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline WideVec3  wide_cross	( const WideVec3& a, const WideVec3& b )	{ return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
@@ -0,0 +1,127 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: thread_pool.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "thread_pool.h"
+
+
+/**
+* @brief start the workers
+* @param thread_count	threads running the loops, including the calling thread
+*/
+ThreadPool::ThreadPool( const unsigned thread_count )
+{
+	for ( unsigned i = 1u; i < thread_count; i++ )
+		m_workers.emplace_back( &ThreadPool::worker_loop, this );
+}
+
+/**
+* @brief stop and join the workers
+*/
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_exit = true;
+	}
+	m_start.notify_all();
+
+	for ( std::thread& worker : m_workers )
+		worker.join();
+}
+
+/**
+* @brief run a loop of parallel_for
+* @param count		size of the range
+* @param grain		indices per chunk
+* @param job		called with the context and the begin and end of every chunk
+* @param context
+*/
+void ThreadPool::start_loop( const unsigned count, const unsigned grain, const Job job, const void* context )
+{
+	if ( count == 0u )
+		return;
+
+	// not worth waking the workers
+	if ( m_workers.empty() || count <= grain )
+	{
+		job( context, 0u, count );
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_job = job;
+		m_context = context;
+		m_count = count;
+		m_grain = grain > 0u ? grain : 1u;
+		m_next = 0u;
+		m_pending = static_cast<unsigned>( m_workers.size() );
+		m_generation++;
+	}
+	m_start.notify_all();
+
+	run_chunks();
+
+	std::unique_lock<std::mutex> lock( m_mutex );
+	m_done.wait( lock, [this]() { return m_pending == 0u; } );
+	m_job = nullptr;
+	m_context = nullptr;
+}
+
+/**
+* @brief get the number of threads running the loops
+* @return threads
+*/
+unsigned ThreadPool::thread_count() const
+{
+	return static_cast<unsigned>( m_workers.size() ) + 1u;
+}
+
+/**
+* @brief wait for loops and work on them until the pool is destroyed
+*/
+void ThreadPool::worker_loop()
+{
+	unsigned generation = 0u;
+
+	while ( true )
+	{
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_start.wait( lock, [&]() { return m_exit || m_generation != generation; } );
+
+			if ( m_exit )
+				return;
+
+			generation = m_generation;
+		}
+
+		run_chunks();
+
+		std::lock_guard<std::mutex> lock( m_mutex );
+		if ( --m_pending == 0u )
+			m_done.notify_one();
+	}
+}
+
+/**
+* @brief take chunks of the current loop until there are none left
+*/
+void ThreadPool::run_chunks()
+{
+	while ( true )
+	{
+		const unsigned begin = m_next.fetch_add( m_grain );
+		if ( begin >= m_count )
+			return;
+
+		const unsigned end = begin + m_grain < m_count ? begin + m_grain : m_count;
+		m_job( m_context, begin, end );
+	}
+}
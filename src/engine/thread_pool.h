@@ -0,0 +1,76 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: thread_pool.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// fixed set of worker threads running parallel loops, the calling thread works too
+class ThreadPool
+{
+public:
+	explicit ThreadPool( const unsigned thread_count = std::thread::hardware_concurrency() );
+	~ThreadPool();
+
+	ThreadPool( const ThreadPool& ) = delete;
+	ThreadPool& operator=( const ThreadPool& ) = delete;
+
+	template <typename Function>
+	void parallel_for( const unsigned count, const unsigned grain, const Function& function );
+
+	unsigned thread_count() const;
+
+private:
+	// function of a loop called with its context and the begin and end of a chunk
+	using Job = void ( * )( const void* context, unsigned begin, unsigned end );
+
+	void start_loop( const unsigned count, const unsigned grain, const Job job, const void* context );
+	void worker_loop();
+	void run_chunks();
+
+private:
+	std::vector<std::thread> m_workers;
+
+	std::mutex				m_mutex;
+	std::condition_variable	m_start;		// a new loop is ready
+	std::condition_variable	m_done;			// every worker finished the loop
+
+	// current loop
+	Job						m_job{ nullptr };
+	const void*				m_context{ nullptr };
+	unsigned				m_count{ 0u };
+	unsigned				m_grain{ 1u };
+	std::atomic<unsigned>	m_next{ 0u };	// first index not taken yet
+
+	unsigned m_generation{ 0u };			// loops started
+	unsigned m_pending{ 0u };				// workers still in the current loop
+	bool	 m_exit{ false };
+};
+
+
+/**
+* @brief	call a function over the range [0, count) split in chunks of the given size,
+*			the chunks run concurrently and the call returns when all of them finished
+* @param count		size of the range
+* @param grain		indices per chunk
+* @param function	called with the begin and end of every chunk, through a plain function
+*					pointer so nothing is allocated per loop
+*/
+template <typename Function>
+void ThreadPool::parallel_for( const unsigned count, const unsigned grain, const Function& function )
+{
+	start_loop( count, grain, []( const void* context, const unsigned begin, const unsigned end )
+	{
+		( *static_cast<const Function*>( context ) )( begin, end );
+	}, &function );
+}
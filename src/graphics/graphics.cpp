@@ -71,9 +71,12 @@ void Graphics::update()
 
 	// render
 	auto& bodies = Physics::get_instance().bodies();
+	auto& transforms = Physics::get_instance().transforms();
 	auto& colors = Physics::get_instance().colors();
 	for ( unsigned i = 0u; i < bodies.size(); i++ )
-		debug_render( bodies[i].mesh, bodies[i].position, bodies[i].scl, bodies[i].rot, colors[i] );
+		debug_render( bodies[i].mesh, transforms[i].model.matrix(), colors[i] );
+
+	Physics::get_instance().debug_draw();
 
 	Editor::get_instance().render();
 
@@ -172,6 +175,22 @@ vec3 Graphics::mouse_pos() const
 * @param color
 */
 void Graphics::debug_render( const HalfEdgeMesh* mesh, const vec3 pos, const vec3 scl, const quat rot, const vec4 color )
+{
+	// model to world transformation matrix
+	mat4 translation	= glm::translate( mat4( 1.0f ), pos );
+	mat4 scale			= glm::scale( mat4( 1.0f ), scl );
+	mat4 rotation		= glm::toMat4( rot );
+
+	debug_render( mesh, translation * rotation * scale, color );
+}
+
+/**
+* @brief render a mesh of lines
+* @param mesh
+* @param model	model to world transformation matrix
+* @param color
+*/
+void Graphics::debug_render( const HalfEdgeMesh* mesh, const mat4& model, const vec4 color )
 {
 	const std::vector<vec3>& vertices = mesh->vertices();
 	const std::vector<unsigned>& indices = mesh->render_indices();
@@ -193,12 +212,7 @@ void Graphics::debug_render( const HalfEdgeMesh* mesh, const vec3 pos, const vec
 	int mvp_loc = glGetUniformLocation( m_program, "uniform_mvp" );
 	int color_loc = glGetUniformLocation( m_program, "uniform_color" );
 
-	// model to world transformation matrix
-	mat4 translation	= glm::translate( mat4( 1.0f ), pos );
-	mat4 scale			= glm::scale( mat4( 1.0f ), scl );
-	mat4 rotation		= glm::toMat4( rot );
-
-	mat4 mvp_mat = m_perspective * m_camera.world_to_cam() * translation * rotation * scale;
+	mat4 mvp_mat = m_perspective * m_camera.world_to_cam() * model;
 
 
 	glUniformMatrix4fv( mvp_loc, 1, GL_FALSE, &mvp_mat[0][0] );
@@ -376,9 +390,5 @@ unsigned Graphics::create_program( const char * vertex_shader, const char * frag
 void Graphics::load_meshes()
 {
 	// load OBJs
-	m_meshes.push_back( load_obj( "../resources/meshes/cube.obj" ) );
-	m_meshes.push_back( load_obj( "../resources/meshes/cylinder.obj" ) );
-	m_meshes.push_back( load_obj( "../resources/meshes/icosahedron.obj" ) );
-	m_meshes.push_back( load_obj( "../resources/meshes/octohedron.obj" ) );
-	m_meshes.push_back( load_obj( "../resources/meshes/sphere.obj" ) );
+	m_meshes = ::load_meshes();
 }
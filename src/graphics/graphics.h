@@ -46,6 +46,7 @@ public:		// PUBLIC METHODS
 	void debug_render( const HalfEdgeMesh* mesh,
 					   const vec3 pos, const vec3 scl, const quat rot,
 					   const vec4 color );
+	void debug_render( const HalfEdgeMesh* mesh, const mat4& model, const vec4 color );
 
 private:	// PRIVATE METHODS
 	void		initialize_glfw	() const;
@@ -78,3 +78,19 @@ Mesh load_obj( const char* file_path )
 
 	return mesh;
 }
+
+/**
+* @brief load the meshes used by the scenes, in the order the scene shapes expect them
+* @return meshes
+*/
+std::vector<Mesh> load_meshes()
+{
+	std::vector<Mesh> meshes;
+	meshes.push_back( load_obj( "../resources/meshes/cube.obj" ) );
+	meshes.push_back( load_obj( "../resources/meshes/cylinder.obj" ) );
+	meshes.push_back( load_obj( "../resources/meshes/icosahedron.obj" ) );
+	meshes.push_back( load_obj( "../resources/meshes/octohedron.obj" ) );
+	meshes.push_back( load_obj( "../resources/meshes/sphere.obj" ) );
+	meshes.push_back( load_obj( "../resources/meshes/capsule.obj" ) );
+	return meshes;
+}
@@ -19,3 +19,4 @@ struct Mesh
 };
 
 Mesh load_obj( const char* file_path );
+std::vector<Mesh> load_meshes();
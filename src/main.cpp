@@ -19,7 +19,7 @@ int main(int argc, char** argv)
 
 	// initialize
 	graphics.initialize();
-	physics.initialize();
+	physics.initialize( graphics.meshes() );
 	editor.initialize();
 
 	float time = static_cast<float>( glfwGetTime() );
@@ -0,0 +1,29 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: main_bench.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "bench.h"
+
+#include <cstdio>
+
+// runs every benchmark, or the ones whose name contains the first argument
+int main( int argc, char** argv )
+{
+	const std::string filter = argc > 1 ? argv[1] : "";
+
+	for ( const Benchmark& benchmark : benchmarks() )
+	{
+		if ( benchmark.name.find( filter ) == std::string::npos )
+			continue;
+
+		printf( "%s\n", benchmark.name.c_str() );
+		benchmark.function();
+	}
+
+	return 0;
+}
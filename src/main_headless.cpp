@@ -0,0 +1,201 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: main_headless.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "physics.h"
+#include "scene.h"
+#include "profiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/**
+* @brief print how to call the runner
+*/
+static void usage()
+{
+	printf( "usage: cs550_headless <scene> [steps] [options]\n"
+			"  --dt <seconds>            fixed time step (default 1/60)\n"
+			"  --out <file>              write the report to a file instead of the console\n"
+			"  --broadphase <0-3>        brute force, aabb tree, sweep and prune, spatial hash\n"
+			"  --solver <mode>           sequential, colored or wide\n"
+			"  --iterations <count>      solver iterations\n"
+			"  --no-sat-cache            run the full SAT query for every pair\n"
+			"  --no-manifold-cache       run the narrowphase for every pair instead of reprojecting the contacts\n"
+			"  --max-contacts <count>    points kept in every contact manifold, 0 keeps all (default 4)\n"
+			"  --narrowphase <type>      sat, gjk or auto\n"
+			"  --no-shape-routines       run sat or gjk for the box pairs too\n"
+			"  --trace <file>            export a chrome trace of every step\n" );
+}
+
+// loads a scene, runs fixed steps without window and writes the timing and the final state of the bodies
+int main( int argc, char** argv )
+{
+	if ( argc < 2 || std::strcmp( argv[1], "--help" ) == 0 )
+	{
+		usage();
+		return argc < 2 ? 1 : 0;
+	}
+
+	const char* scene_file = argv[1];
+	int steps = 600;
+	float dt = 1.0f / 60.0f;
+	const char* out_file = nullptr;
+	const char* trace_file = nullptr;
+
+	Physics& physics = Physics::get_instance();
+	physics.initialize( load_meshes() );
+
+	// options
+	for ( int i = 2; i < argc; i++ )
+	{
+		const bool has_value = i + 1 < argc;
+
+		if ( argv[i][0] != '-' )
+			steps = std::atoi( argv[i] );
+		else if ( std::strcmp( argv[i], "--dt" ) == 0 && has_value )
+			dt = static_cast<float>( std::atof( argv[++i] ) );
+		else if ( std::strcmp( argv[i], "--out" ) == 0 && has_value )
+			out_file = argv[++i];
+		else if ( std::strcmp( argv[i], "--trace" ) == 0 && has_value )
+			trace_file = argv[++i];
+		else if ( std::strcmp( argv[i], "--broadphase" ) == 0 && has_value )
+			physics.set_broadphase( static_cast<BroadphaseType>( std::atoi( argv[++i] ) ) );
+		else if ( std::strcmp( argv[i], "--no-sat-cache" ) == 0 )
+			physics.set_sat_caching( false );
+		else if ( std::strcmp( argv[i], "--no-manifold-cache" ) == 0 )
+			physics.set_manifold_caching( false );
+		else if ( std::strcmp( argv[i], "--max-contacts" ) == 0 && has_value )
+			physics.set_max_contact_points( static_cast<unsigned>( std::atoi( argv[++i] ) ) );
+		else if ( std::strcmp( argv[i], "--no-shape-routines" ) == 0 )
+			physics.set_shape_routines( false );
+		else if ( std::strcmp( argv[i], "--iterations" ) == 0 && has_value )
+			physics.set_solver_iterations( std::atoi( argv[++i] ) );
+		else if ( std::strcmp( argv[i], "--narrowphase" ) == 0 && has_value )
+		{
+			const std::string type = argv[++i];
+			if ( type == "sat" )
+				physics.set_narrowphase( NarrowphaseType::Sat );
+			else if ( type == "gjk" )
+				physics.set_narrowphase( NarrowphaseType::Gjk );
+			else if ( type == "auto" )
+				physics.set_narrowphase( NarrowphaseType::Auto );
+			else
+			{
+				printf( "unknown narrowphase %s\n", type.c_str() );
+				return 1;
+			}
+		}
+		else if ( std::strcmp( argv[i], "--solver" ) == 0 && has_value )
+		{
+			const std::string mode = argv[++i];
+			if ( mode == "sequential" )
+				physics.set_solver_mode( SolverMode::Sequential );
+			else if ( mode == "colored" )
+				physics.set_solver_mode( SolverMode::Colored );
+			else if ( mode == "wide" )
+				physics.set_solver_mode( SolverMode::Wide );
+			else
+			{
+				printf( "unknown solver mode %s\n", mode.c_str() );
+				return 1;
+			}
+		}
+		else
+		{
+			printf( "unknown option %s\n", argv[i] );
+			usage();
+			return 1;
+		}
+	}
+
+	Scene scene;
+	if ( scene.load_scene( scene_file ) == false )
+		return 1;
+
+	Profiler& profiler = Profiler::get_instance();
+	if ( trace_file != nullptr )
+		profiler.capture( static_cast<unsigned>( steps ), trace_file );
+
+	// run
+	ProfileFrame phases;
+	double total = 0.0;
+	double min_step = steps > 0 ? 1e30 : 0.0;
+	double max_step = 0.0;
+
+	for ( int i = 0; i < steps; i++ )
+	{
+		const auto start = std::chrono::steady_clock::now();
+		physics.update( dt );
+		const auto end = std::chrono::steady_clock::now();
+
+		const double time = std::chrono::duration<double, std::milli>( end - start ).count();
+		total += time;
+		min_step = time < min_step ? time : min_step;
+		max_step = time > max_step ? time : max_step;
+
+		for ( unsigned phase = 0u; phase < static_cast<unsigned>( ProfilePhase::Count ); phase++ )
+		{
+			phases.nanoseconds[phase] += profiler.last_frame().nanoseconds[phase];
+			phases.calls[phase] += profiler.last_frame().calls[phase];
+		}
+		for ( unsigned counter = 0u; counter < static_cast<unsigned>( ProfileCounter::Count ); counter++ )
+			phases.counters[counter] += profiler.last_frame().counters[counter];
+	}
+
+	// report
+	FILE* out = out_file != nullptr ? std::fopen( out_file, "w" ) : stdout;
+	if ( out == nullptr )
+	{
+		printf( "couldn't open file %s\n", out_file );
+		return 1;
+	}
+
+	fprintf( out, "scene %s\n", scene_file );
+	fprintf( out, "steps %d dt %f\n", steps, dt );
+	fprintf( out, "total_ms %.3f\n", total );
+	fprintf( out, "step_ms avg %.4f min %.4f max %.4f\n", steps > 0 ? total / steps : 0.0, min_step, max_step );
+
+#if PROFILER_ENABLED
+	for ( unsigned phase = 0u; phase < static_cast<unsigned>( ProfilePhase::Count ); phase++ )
+		fprintf( out, "phase \"%s\" total_ms %.3f calls %u\n", phase_name( static_cast<ProfilePhase>( phase ) ),
+				 phases.nanoseconds[phase] / 1e6, phases.calls[phase] );
+	for ( unsigned counter = 0u; counter < static_cast<unsigned>( ProfileCounter::Count ); counter++ )
+		fprintf( out, "counter \"%s\" total %u\n", counter_name( static_cast<ProfileCounter>( counter ) ), phases.counters[counter] );
+#endif
+
+	const std::vector<RigidBody>& bodies = physics.bodies();
+
+	unsigned awake = 0u;
+	for ( const RigidBody& body : bodies )
+		if ( body.mass != 0.0f && body.is_awake() )
+			awake++;
+	fprintf( out, "bodies %u awake %u\n", static_cast<unsigned>( bodies.size() ), awake );
+
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		const RigidBody& body = bodies[i];
+		fprintf( out, "body %u position %.6f %.6f %.6f rotation %.6f %.6f %.6f %.6f "
+					  "linear_velocity %.6f %.6f %.6f angular_velocity %.6f %.6f %.6f awake %d\n", i,
+				 body.position.x, body.position.y, body.position.z,
+				 body.rot.w, body.rot.x, body.rot.y, body.rot.z,
+				 body.linear_velocity.x, body.linear_velocity.y, body.linear_velocity.z,
+				 body.angular_velocity.x, body.angular_velocity.y, body.angular_velocity.z,
+				 body.is_awake() ? 1 : 0 );
+	}
+
+	if ( out != stdout )
+		std::fclose( out );
+
+	physics.exit();
+
+	return 0;
+}
@@ -0,0 +1,457 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: aabb_tree.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "aabb_tree.h"
+
+#include <algorithm>
+
+
+float AabbTree::margin		= 0.1f;
+float AabbTree::prediction	= 2.0f;
+
+/**
+* @brief check if the node is a leaf
+* @return is leaf
+*/
+bool AabbTreeNode::is_leaf() const
+{
+	return left == null;
+}
+
+
+
+
+
+
+/*		AABB TREE		*/
+
+/**
+* @brief remove every node of the tree
+*/
+void AabbTree::clear()
+{
+	m_nodes.clear();
+	m_root = AabbTreeNode::null;
+	m_free_list = AabbTreeNode::null;
+}
+
+/**
+* @brief insert a new leaf in the tree
+* @param aabb	tight bounding box of the body
+* @param body	index of the body
+* @return proxy of the leaf
+*/
+int AabbTree::create_proxy( const AABB& aabb, const unsigned body )
+{
+	const int proxy = allocate_node();
+
+	m_nodes[proxy].aabb = fatten_aabb( aabb, margin );
+	m_nodes[proxy].body = body;
+	m_nodes[proxy].height = 0;
+
+	insert_leaf( proxy );
+
+	return proxy;
+}
+
+/**
+* @brief remove a leaf from the tree
+* @param proxy
+*/
+void AabbTree::destroy_proxy( const int proxy )
+{
+	remove_leaf( proxy );
+	free_node( proxy );
+}
+
+/**
+* @brief update the bounding box of a leaf, it is only reinserted if it left its fat box
+* @param proxy
+* @param aabb			new tight bounding box
+* @param displacement	movement of the body since the last update
+* @return the leaf was reinserted
+*/
+bool AabbTree::move_proxy( const int proxy, const AABB& aabb, const vec3 displacement )
+{
+	// still inside the fat box, nothing to do
+	if ( contains_aabb( m_nodes[proxy].aabb, aabb ) )
+		return false;
+
+	remove_leaf( proxy );
+
+	// enlarge the box in the direction of the movement
+	AABB fat = fatten_aabb( aabb, margin );
+	const vec3 d = displacement * prediction;
+
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		if ( d[i] < 0.0f )
+			fat.min[i] += d[i];
+		else
+			fat.max[i] += d[i];
+	}
+
+	m_nodes[proxy].aabb = fat;
+
+	insert_leaf( proxy );
+
+	return true;
+}
+
+/**
+* @brief get the fat bounding box of a leaf
+* @param proxy
+* @return bounding box
+*/
+const AABB& AabbTree::fat_aabb( const int proxy ) const
+{
+	return m_nodes[proxy].aabb;
+}
+
+/**
+* @brief get the body of a leaf
+* @param proxy
+* @return body index
+*/
+unsigned AabbTree::body( const int proxy ) const
+{
+	return m_nodes[proxy].body;
+}
+
+/**
+* @brief get the height of the tree
+* @return height
+*/
+int AabbTree::height() const
+{
+	if ( m_root == AabbTreeNode::null )
+		return 0;
+
+	return m_nodes[m_root].height;
+}
+
+
+
+
+
+
+/**
+* @brief get a node from the free list or grow the node pool
+* @return node index
+*/
+int AabbTree::allocate_node()
+{
+	if ( m_free_list == AabbTreeNode::null )
+	{
+		m_nodes.push_back( AabbTreeNode{} );
+		return static_cast<int>( m_nodes.size() ) - 1;
+	}
+
+	const int node = m_free_list;
+	m_free_list = m_nodes[node].parent;
+	m_nodes[node] = AabbTreeNode{};
+
+	return node;
+}
+
+/**
+* @brief return a node to the free list
+* @param node
+*/
+void AabbTree::free_node( const int node )
+{
+	m_nodes[node].parent = m_free_list;
+	m_nodes[node].height = -1;
+	m_free_list = node;
+}
+
+/**
+* @brief insert a leaf where it increases the least the surface area of the tree
+* @param leaf
+*/
+void AabbTree::insert_leaf( const int leaf )
+{
+	if ( m_root == AabbTreeNode::null )
+	{
+		m_root = leaf;
+		m_nodes[leaf].parent = AabbTreeNode::null;
+		return;
+	}
+
+	const AABB leaf_aabb = m_nodes[leaf].aabb;
+
+	// find the best sibling O(log n)
+	int index = m_root;
+	while ( m_nodes[index].is_leaf() == false )
+	{
+		const AabbTreeNode& node = m_nodes[index];
+
+		const float area = aabb_area( node.aabb );
+		const float combined_area = aabb_area( merge_aabb( node.aabb, leaf_aabb ) );
+
+		// cost of creating a new parent for this node and the leaf
+		const float cost = 2.0f * combined_area;
+
+		// minimum cost of pushing the leaf further down the tree
+		const float inheritance_cost = 2.0f * ( combined_area - area );
+
+		auto descend_cost = [&]( const int child )
+		{
+			const AABB aabb = merge_aabb( leaf_aabb, m_nodes[child].aabb );
+			if ( m_nodes[child].is_leaf() )
+				return aabb_area( aabb ) + inheritance_cost;
+			return aabb_area( aabb ) - aabb_area( m_nodes[child].aabb ) + inheritance_cost;
+		};
+
+		const float cost_left = descend_cost( node.left );
+		const float cost_right = descend_cost( node.right );
+
+		if ( cost < cost_left && cost < cost_right )
+			break;
+
+		index = cost_left < cost_right ? node.left : node.right;
+	}
+
+	const int sibling = index;
+
+	// create a new parent for the sibling and the leaf
+	const int old_parent = m_nodes[sibling].parent;
+	const int new_parent = allocate_node();
+
+	m_nodes[new_parent].parent = old_parent;
+	m_nodes[new_parent].aabb = merge_aabb( leaf_aabb, m_nodes[sibling].aabb );
+	m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+	m_nodes[new_parent].left = sibling;
+	m_nodes[new_parent].right = leaf;
+	m_nodes[sibling].parent = new_parent;
+	m_nodes[leaf].parent = new_parent;
+
+	if ( old_parent == AabbTreeNode::null )
+		m_root = new_parent;
+	else if ( m_nodes[old_parent].left == sibling )
+		m_nodes[old_parent].left = new_parent;
+	else
+		m_nodes[old_parent].right = new_parent;
+
+	// fix the boxes and heights of the ancestors
+	refit( m_nodes[leaf].parent );
+}
+
+/**
+* @brief remove a leaf from the tree, its sibling takes the place of the parent
+* @param leaf
+*/
+void AabbTree::remove_leaf( const int leaf )
+{
+	if ( leaf == m_root )
+	{
+		m_root = AabbTreeNode::null;
+		return;
+	}
+
+	const int parent = m_nodes[leaf].parent;
+	const int grand_parent = m_nodes[parent].parent;
+	const int sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+	m_nodes[sibling].parent = grand_parent;
+	free_node( parent );
+
+	if ( grand_parent == AabbTreeNode::null )
+	{
+		m_root = sibling;
+		return;
+	}
+
+	if ( m_nodes[grand_parent].left == parent )
+		m_nodes[grand_parent].left = sibling;
+	else
+		m_nodes[grand_parent].right = sibling;
+
+	refit( grand_parent );
+}
+
+/**
+* @brief walk up the tree fixing boxes and heights and rotating unbalanced nodes
+* @param node	first node to refit
+*/
+void AabbTree::refit( int node )
+{
+	while ( node != AabbTreeNode::null )
+	{
+		node = balance( node );
+
+		const int left = m_nodes[node].left;
+		const int right = m_nodes[node].right;
+
+		m_nodes[node].height = 1 + std::max( m_nodes[left].height, m_nodes[right].height );
+		m_nodes[node].aabb = merge_aabb( m_nodes[left].aabb, m_nodes[right].aabb );
+
+		node = m_nodes[node].parent;
+	}
+}
+
+/**
+* @brief	rotate the node if one of the children is deeper than the other by more than one level
+*
+*			  A				  C
+*			 / \			 / \
+*			B   C	  ->	A   F/G
+*			   / \		   / \
+*			  F   G		  B  G/F
+*
+* @param a	node to balance
+* @return	node that took the place of a
+*/
+int AabbTree::balance( const int a )
+{
+	AabbTreeNode& node_A = m_nodes[a];
+
+	if ( node_A.is_leaf() || node_A.height < 2 )
+		return a;
+
+	const int b = node_A.left;
+	const int c = node_A.right;
+
+	const int difference = m_nodes[c].height - m_nodes[b].height;
+
+	// the higher child is promoted, its lower grandchild goes down to a
+	auto rotate = [&]( const int up, const int other, const bool up_is_right )
+	{
+		AabbTreeNode& node_up = m_nodes[up];
+
+		const int f = node_up.left;
+		const int g = node_up.right;
+
+		// swap a and up
+		node_up.left = a;
+		node_up.parent = node_A.parent;
+		node_A.parent = up;
+
+		if ( node_up.parent == AabbTreeNode::null )
+			m_root = up;
+		else if ( m_nodes[node_up.parent].left == a )
+			m_nodes[node_up.parent].left = up;
+		else
+			m_nodes[node_up.parent].right = up;
+
+		// keep the higher grandchild in up
+		const int high	= m_nodes[f].height > m_nodes[g].height ? f : g;
+		const int low	= high == f ? g : f;
+
+		node_up.right = high;
+		if ( up_is_right )
+			node_A.right = low;
+		else
+			node_A.left = low;
+		m_nodes[low].parent = a;
+
+		node_A.aabb = merge_aabb( m_nodes[other].aabb, m_nodes[low].aabb );
+		node_up.aabb = merge_aabb( node_A.aabb, m_nodes[high].aabb );
+
+		node_A.height = 1 + std::max( m_nodes[other].height, m_nodes[low].height );
+		node_up.height = 1 + std::max( node_A.height, m_nodes[high].height );
+
+		return up;
+	};
+
+	// right child is deeper
+	if ( difference > 1 )
+		return rotate( c, b, true );
+
+	// left child is deeper
+	if ( difference < -1 )
+		return rotate( b, c, false );
+
+	return a;
+}
+
+
+
+
+
+
+/*		BROADPHASE TREE		*/
+
+/**
+* @brief refit the moved bodies and find the overlapping fat boxes
+* @param bodies
+*/
+void BroadphaseTree::update( const std::vector<RigidBody>& bodies )
+{
+	// bodies were removed, start over
+	if ( bodies.size() < m_proxies.size() )
+		clear();
+
+	// refit the existing proxies
+	for ( unsigned i = 0u; i < m_proxies.size(); i++ )
+	{
+		const AABB aabb = compute_aabb( bodies[i] );
+		const vec3 center = ( aabb.min + aabb.max ) * 0.5f;
+
+		m_tree.move_proxy( m_proxies[i], aabb, center - m_centers[i] );
+		m_centers[i] = center;
+	}
+
+	// add the new bodies
+	for ( unsigned i = static_cast<unsigned>( m_proxies.size() ); i < bodies.size(); i++ )
+	{
+		const AABB aabb = compute_aabb( bodies[i] );
+
+		m_proxies.push_back( m_tree.create_proxy( aabb, i ) );
+		m_centers.push_back( ( aabb.min + aabb.max ) * 0.5f );
+	}
+
+	m_pairs.clear();
+	m_pair_tests = 0u;
+
+	// query the tree with every dynamic body O(n log n), only pairs of static bodies are not
+	// needed. The pairs of sleeping bodies are kept for the islands woken up in the step
+	for ( unsigned i = 0u; i < m_proxies.size(); i++ )
+	{
+		if ( bodies[i].mass == 0.0f )
+			continue;
+
+		m_pair_tests += m_tree.query( m_tree.fat_aabb( m_proxies[i] ), [&]( const int proxy )
+		{
+			const unsigned j = m_tree.body( proxy );
+			if ( j == i )
+				return;
+
+			// pairs of dynamic bodies are found from both bodies, keep only one
+			if ( bodies[j].mass != 0.0f && j < i )
+				return;
+
+			m_pairs.push_back( BodyPair{ glm::min( i, j ), glm::max( i, j ) } );
+		} );
+	}
+
+	// same order as the brute force so the solver sees the contacts in the same order
+	std::sort( m_pairs.begin(), m_pairs.end() );
+}
+
+/**
+* @brief remove every proxy
+*/
+void BroadphaseTree::clear()
+{
+	m_tree.clear();
+	m_proxies.clear();
+	m_centers.clear();
+	m_pairs.clear();
+	m_pair_tests = 0u;
+}
+
+/**
+* @brief get the tree
+* @return tree
+*/
+const AabbTree& BroadphaseTree::tree() const
+{
+	return m_tree;
+}
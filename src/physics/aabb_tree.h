@@ -0,0 +1,126 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: aabb_tree.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "broadphase.h"
+
+#include <vector>
+
+struct AabbTreeNode
+{
+	static const int null = -1;
+
+	bool is_leaf() const;
+
+	AABB aabb;			// fat bounding box
+
+	int parent{ null };	// parent node (next free node when in the free list)
+	int left{ null };
+	int right{ null };
+	int height{ 0 };	// leaf = 0, free = -1
+
+	unsigned body{ 0u };	// body of the leaf
+};
+
+class AabbTree
+{
+public:
+	void clear();
+
+	int  create_proxy	( const AABB& aabb, const unsigned body );
+	void destroy_proxy	( const int proxy );
+	bool move_proxy		( const int proxy, const AABB& aabb, const vec3 displacement );
+
+	const AABB& fat_aabb( const int proxy ) const;
+	unsigned	body	( const int proxy ) const;
+	int			height	() const;
+
+	template <typename Callback>
+	unsigned query( const AABB& aabb, Callback callback ) const;
+
+public:
+	static float margin;		// extra size of the fat bounding boxes
+	static float prediction;	// multiplier of the displacement added to the fat bounding boxes
+
+private:
+	int  allocate_node	();
+	void free_node		( const int node );
+	void insert_leaf	( const int leaf );
+	void remove_leaf	( const int leaf );
+	int  balance		( const int node );
+	void refit			( int node );
+
+private:
+	std::vector<AabbTreeNode> m_nodes;
+	int m_root{ AabbTreeNode::null };
+	int m_free_list{ AabbTreeNode::null };
+
+	mutable std::vector<int> m_stack;	// traversal stack (reused between queries)
+};
+
+
+// pairs of two static bodies are not reported
+class BroadphaseTree : public Broadphase
+{
+public:
+	void update( const std::vector<RigidBody>& bodies ) final;
+	void clear() final;
+
+	const AabbTree& tree() const;
+
+private:
+	AabbTree			m_tree;
+	std::vector<int>	m_proxies;	// proxy of each body
+	std::vector<vec3>	m_centers;	// center of the tight box in the last update
+};
+
+
+/**
+* @brief find every leaf overlapping a bounding box
+* @param aabb		box to check against
+* @param callback	function called with the proxy of each overlapping leaf
+* @return number of bounding box tests done
+*/
+template <typename Callback>
+unsigned AabbTree::query( const AABB& aabb, Callback callback ) const
+{
+	unsigned tests = 0u;
+
+	if ( m_root == AabbTreeNode::null )
+		return tests;
+
+	m_stack.clear();
+	m_stack.push_back( m_root );
+
+	// O(log n) for small boxes
+	while ( m_stack.empty() == false )
+	{
+		const int id = m_stack.back();
+		m_stack.pop_back();
+
+		const AabbTreeNode& node = m_nodes[id];
+
+		tests++;
+		if ( overlap_aabb( node.aabb, aabb ) == false )
+			continue;
+
+		if ( node.is_leaf() )
+		{
+			callback( id );
+		}
+		else
+		{
+			m_stack.push_back( node.left );
+			m_stack.push_back( node.right );
+		}
+	}
+
+	return tests;
+}
@@ -0,0 +1,385 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: box_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "box_collision.h"
+#include "profiler.h"
+
+#include <limits>
+#include <utility>
+
+std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, const vec3& b0, const vec3& b1 );
+unsigned combine_features( const unsigned a, const unsigned b, const unsigned c );
+
+// the incident face has 4 vertices and every side plane adds one more at most
+static const unsigned max_clip_points = 8u;
+
+/**
+* @brief id of a face of a box, two per axis
+* @param axis
+* @param sign	side of the axis
+*/
+static unsigned box_face_id( const unsigned axis, const float sign )
+{
+	return axis * 2u + ( sign < 0.0f ? 1u : 0u );
+}
+
+/**
+* @brief get the box of a body, from the bounds of its mesh
+* @param body
+* @param transform	transformation of the body from the cache of the step
+* @return box
+*/
+Box make_box( const RigidBody& body, const BodyTransform& transform )
+{
+	Box box;
+	box.center = transform.model.translation;
+
+	// the columns of the model are the axes scaled
+	for ( unsigned i = 0u; i < 3u; i++ )
+		box.axes[i] = transform.model.linear[i] / body.scl[i];
+	box.half_extents = glm::abs( ( body.mesh->bounds_max() - body.mesh->bounds_min() ) * 0.5f * body.scl );
+
+	return box;
+}
+
+/**
+* @brief	clip a polygon with the plane dot( normal, point ) = offset, keeping the points under it.
+*			Clipped points are identified by the segment and the plane, as in the generic sat
+* @param points		polygon
+* @param features	features of the points
+* @param count		number of points
+* @param normal
+* @param offset
+* @param plane_id
+* @return out_points	clipped polygon
+* @return out_features
+* @return number of clipped points
+*/
+static unsigned clip_polygon( const vec3* points, const unsigned* features, const unsigned count, const vec3& normal, const float offset,
+							  const unsigned plane_id, vec3* out_points, unsigned* out_features )
+{
+	unsigned out_count = 0u;
+
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		const unsigned next = ( i + 1u ) % count;
+		const float t1 = dot( normal, points[i] ) - offset;
+		const float t2 = dot( normal, points[next] ) - offset;
+
+		// both points out
+		if ( t1 > 0.0f && t2 > 0.0f )
+			continue;
+
+		const unsigned clip_feature = combine_features( features[i], features[next], plane_id );
+
+		// first point in, second point out
+		if ( t2 > 0.0f )
+		{
+			out_points[out_count] = ( points[next] - points[i] ) * ( -t1 / ( -t1 + t2 ) ) + points[i];
+			out_features[out_count++] = clip_feature;
+		}
+		else
+		{
+			// first point out, second point in
+			if ( t1 > 0.0f )
+			{
+				out_points[out_count] = ( points[next] - points[i] ) * ( t1 / ( t1 - t2 ) ) + points[i];
+				out_features[out_count++] = clip_feature;
+			}
+			// second point in
+			out_points[out_count] = points[next];
+			out_features[out_count++] = features[next];
+		}
+	}
+
+	return out_count;
+}
+
+/**
+* @brief	contact points of a face of the reference box, the incident face of the other box is
+*			clipped with the four sides of the reference face
+* @param body_ref		body with the reference face
+* @param body_inc		body with the incident face
+* @param ref			box of body_ref
+* @param inc			box of body_inc
+* @param axis			axis of the reference face
+* @return contact manifold, from body_ref to body_inc
+*/
+static ContactManifold box_face_manifold( RigidBody& body_ref, RigidBody& body_inc, const Box& ref, const Box& inc, const unsigned axis )
+{
+	PROFILE_SCOPE( ProfilePhase::Clipping );
+
+	// the reference face looks at the other box
+	const float ref_sign = dot( inc.center - ref.center, ref.axes[axis] ) >= 0.0f ? 1.0f : -1.0f;
+	const vec3 normal = ref.axes[axis] * ref_sign;
+
+	// the incident face is the most antiparallel to the normal
+	unsigned inc_axis = 0u;
+	float max_dot = -1.0f;
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		const float alignment = std::abs( dot( inc.axes[i], normal ) );
+		if ( alignment > max_dot )
+		{
+			max_dot = alignment;
+			inc_axis = i;
+		}
+	}
+	const float inc_sign = dot( inc.axes[inc_axis], normal ) > 0.0f ? -1.0f : 1.0f;
+
+	// vertices of the incident face, identified by the sides of the box they are on
+	const unsigned k1 = ( inc_axis + 1u ) % 3u;
+	const unsigned k2 = ( inc_axis + 2u ) % 3u;
+	const vec3 face_center = inc.center + inc.axes[inc_axis] * ( inc.half_extents[inc_axis] * inc_sign );
+	const vec3 u = inc.axes[k1] * inc.half_extents[k1];
+	const vec3 v = inc.axes[k2] * inc.half_extents[k2];
+	const unsigned face_bit = inc_sign < 0.0f ? 1u << inc_axis : 0u;
+
+	vec3 points[2][max_clip_points] = { { face_center + u + v, face_center - u + v, face_center - u - v, face_center + u - v } };
+	unsigned features[2][max_clip_points] = { { face_bit, face_bit | 1u << k1, face_bit | 1u << k1 | 1u << k2, face_bit | 1u << k2 } };
+	unsigned count = 4u;
+	unsigned current = 0u;
+
+	// side planes of the reference face
+	const unsigned i1 = ( axis + 1u ) % 3u;
+	const unsigned i2 = ( axis + 2u ) % 3u;
+	const vec3 side_normals[4] = { ref.axes[i1], -ref.axes[i1], ref.axes[i2], -ref.axes[i2] };
+	const float side_extents[4] = { ref.half_extents[i1], ref.half_extents[i1], ref.half_extents[i2], ref.half_extents[i2] };
+
+	for ( unsigned plane_id = 0u; plane_id < 4u && count > 0u; plane_id++ )
+	{
+		const float offset = dot( side_normals[plane_id], ref.center ) + side_extents[plane_id];
+		count = clip_polygon( points[current], features[current], count, side_normals[plane_id], offset, plane_id, points[1u - current], features[1u - current] );
+		current = 1u - current;
+	}
+
+	// contact data
+	ContactManifold contact;
+	contact.normal = normal;
+	contact.feature = box_face_id( axis, ref_sign ) << 16u | box_face_id( inc_axis, inc_sign );
+
+	// ignore points outside the reference face
+	const float face_offset = dot( normal, ref.center ) + ref.half_extents[axis];
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		const vec3& point = points[current][i];
+		const float penetration = dot( normal, point ) - face_offset;
+		if ( penetration <= 0.0f )
+			contact.points.push_back( ContactPoint{ point - penetration * normal, point, -penetration, 0.0f, 0.0f, features[current][i] } );
+	}
+
+	contact.body_A = &body_ref;
+	contact.body_B = &body_inc;
+
+	return contact;
+}
+
+/**
+* @brief contact point of an edge of each box, the closest points of the edges
+* @param body_A
+* @param body_B
+* @param A				box of body_A
+* @param B				box of body_B
+* @param axis_A		axis the edge of A is parallel to
+* @param axis_B		axis the edge of B is parallel to
+* @param separation	separation along the cross product of the edges
+* @return contact manifold
+*/
+static ContactManifold box_edge_manifold( RigidBody& body_A, RigidBody& body_B, const Box& A, const Box& B,
+										  const unsigned axis_A, const unsigned axis_B, const float separation )
+{
+	PROFILE_SCOPE( ProfilePhase::Clipping );
+
+	// normal from A to B
+	vec3 normal = normalize( cross( A.axes[axis_A], B.axes[axis_B] ) );
+	if ( dot( normal, B.center - A.center ) < 0.0f )
+		normal = -normal;
+
+	// the edges the furthest into the other box, identified by their axis and the sides of their box
+	vec3 center_A = A.center;
+	vec3 center_B = B.center;
+	unsigned sides_A = 0u;
+	unsigned sides_B = 0u;
+	for ( unsigned k = 0u; k < 3u; k++ )
+	{
+		if ( k != axis_A )
+		{
+			const float sign = dot( A.axes[k], normal ) >= 0.0f ? 1.0f : -1.0f;
+			center_A += A.axes[k] * ( A.half_extents[k] * sign );
+			sides_A |= sign < 0.0f ? 1u << k : 0u;
+		}
+		if ( k != axis_B )
+		{
+			const float sign = dot( B.axes[k], normal ) <= 0.0f ? 1.0f : -1.0f;
+			center_B += B.axes[k] * ( B.half_extents[k] * sign );
+			sides_B |= sign < 0.0f ? 1u << k : 0u;
+		}
+	}
+	const vec3 extent_A = A.axes[axis_A] * A.half_extents[axis_A];
+	const vec3 extent_B = B.axes[axis_B] * B.half_extents[axis_B];
+
+	const auto points = closest_points_segment( center_A - extent_A, center_A + extent_A, center_B - extent_B, center_B + extent_B );
+
+	ContactManifold contact;
+	contact.normal = normal;
+	contact.feature = combine_features( combine_features( axis_A, sides_A, 0u ), combine_features( axis_B, sides_B, 0u ), 1u );
+	contact.points.push_back( { points.first, points.second, -separation, 0.0f, 0.0f, contact.feature } );
+	contact.body_A = &body_A;
+	contact.body_B = &body_B;
+
+	return contact;
+}
+
+/**
+* @brief	separating axis test of two boxes. The 3 face axes of each box and the 9 cross products
+*			of their edges are projected with the rotation of B in the frame of A, whose absolute
+*			values are computed once for every axis
+* @param body_A
+* @param body_B
+* @param contact_data	return manifold of the collision
+* @return the boxes are colliding
+*/
+bool overlap_box_box( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data )
+{
+	return overlap_box_box( body_A, body_B, contact_data, make_body_transform( body_A ), make_body_transform( body_B ) );
+}
+
+/**
+* @brief separating axis test of two boxes
+* @param body_A
+* @param body_B
+* @param contact_data	return manifold of the collision
+* @param transform_A	transformation of body A from the cache of the step
+* @param transform_B	transformation of body B from the cache of the step
+* @return the boxes are colliding
+*/
+bool overlap_box_box( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const BodyTransform& transform_A, const BodyTransform& transform_B )
+{
+	PROFILE_SCOPE( ProfilePhase::Shapes );
+
+	// same preference of faces over edges as overlap_sat
+	const float epsilon = 0.005f;
+
+	// parallel edges have a null cross product, the face axes already test them
+	const float parallel = 1e-6f;
+
+	const Box A = make_box( body_A, transform_A );
+	const Box B = make_box( body_B, transform_B );
+	const vec3& a = A.half_extents;
+	const vec3& b = B.half_extents;
+
+	// rotation of B in the frame of A
+	float R[3][3];
+	float abs_R[3][3];
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		for ( unsigned j = 0u; j < 3u; j++ )
+		{
+			R[i][j] = dot( A.axes[i], B.axes[j] );
+			abs_R[i][j] = std::abs( R[i][j] ) + parallel;
+		}
+	}
+
+	// center of B in the frame of A
+	const vec3 d = B.center - A.center;
+	const vec3 t = vec3( dot( d, A.axes[0] ), dot( d, A.axes[1] ), dot( d, A.axes[2] ) );
+
+	// faces of A
+	float separation_A = -std::numeric_limits<float>::max();
+	unsigned face_A = 0u;
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		const float separation = std::abs( t[i] ) - ( a[i] + b[0] * abs_R[i][0] + b[1] * abs_R[i][1] + b[2] * abs_R[i][2] );
+		if ( separation > 0.0f )
+			return false;
+		if ( separation > separation_A )
+		{
+			separation_A = separation;
+			face_A = i;
+		}
+	}
+
+	// faces of B
+	float separation_B = -std::numeric_limits<float>::max();
+	unsigned face_B = 0u;
+	for ( unsigned j = 0u; j < 3u; j++ )
+	{
+		const float separation = std::abs( t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j] ) -
+								 ( a[0] * abs_R[0][j] + a[1] * abs_R[1][j] + a[2] * abs_R[2][j] + b[j] );
+		if ( separation > 0.0f )
+			return false;
+		if ( separation > separation_B )
+		{
+			separation_B = separation;
+			face_B = j;
+		}
+	}
+
+	// edges, the cross product of the axis i of A and j of B is ( 0, -R[2][j], R[1][j] ) for i = 0
+	float separation_edge = -std::numeric_limits<float>::max();
+	unsigned edge_A = 0u;
+	unsigned edge_B = 0u;
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		const unsigned i1 = ( i + 1u ) % 3u;
+		const unsigned i2 = ( i + 2u ) % 3u;
+
+		for ( unsigned j = 0u; j < 3u; j++ )
+		{
+			const unsigned j1 = ( j + 1u ) % 3u;
+			const unsigned j2 = ( j + 2u ) % 3u;
+
+			const float length = std::sqrt( R[i1][j] * R[i1][j] + R[i2][j] * R[i2][j] );
+			if ( length < 1e-3f )
+				continue;
+
+			const float radius_A = a[i1] * abs_R[i2][j] + a[i2] * abs_R[i1][j];
+			const float radius_B = b[j1] * abs_R[i][j2] + b[j2] * abs_R[i][j1];
+			const float separation = ( std::abs( t[i2] * R[i1][j] - t[i1] * R[i2][j] ) - ( radius_A + radius_B ) ) / length;
+			if ( separation > 0.0f )
+				return false;
+			if ( separation > separation_edge )
+			{
+				separation_edge = separation;
+				edge_A = i;
+				edge_B = j;
+			}
+		}
+	}
+
+	// at this point there is no separation axis so the two boxes are colliding
+	int collision_case = 0;
+	if ( separation_A > separation_B - epsilon )
+	{
+		if ( separation_A < separation_edge - epsilon )
+			collision_case = 2;
+	}
+	else
+	{
+		if ( separation_B < separation_edge - epsilon )
+			collision_case = 2;
+		else
+			collision_case = 1;
+	}
+
+	switch ( collision_case )
+	{
+	case 0:
+		contact_data = box_face_manifold( body_A, body_B, A, B, face_A );
+		break;
+	case 1:
+		contact_data = box_face_manifold( body_B, body_A, B, A, face_B );
+		break;
+	case 2:
+		contact_data = box_edge_manifold( body_A, body_B, A, B, edge_A, edge_B, separation_edge );
+		break;
+	}
+
+	return true;
+}
@@ -0,0 +1,29 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: box_collision.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+#include "transform.h"
+
+#include "math_utils.h"
+
+// oriented box of a body in world space
+struct Box
+{
+	vec3 center;
+	vec3 axes[3];
+	vec3 half_extents;
+};
+
+Box make_box( const RigidBody& body, const BodyTransform& transform );
+
+bool overlap_box_box( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data );
+bool overlap_box_box( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const BodyTransform& transform_A, const BodyTransform& transform_B );
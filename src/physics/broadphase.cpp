@@ -0,0 +1,192 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: broadphase.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "broadphase.h"
+
+#include "aabb_tree.h"
+#include "sweep_and_prune.h"
+#include "spatial_hash.h"
+
+/**
+* @brief get the candidate pairs of the last update
+* @return pairs
+*/
+const std::vector<BodyPair>& Broadphase::pairs() const
+{
+	return m_pairs;
+}
+
+/**
+* @brief get the number of bounding volume tests done in the last update
+* @return tests
+*/
+unsigned Broadphase::pair_tests() const
+{
+	return m_pair_tests;
+}
+
+
+
+
+/**
+* @brief report every pair of bodies as a candidate
+* @param bodies
+*/
+void BroadphaseBruteForce::update( const std::vector<RigidBody>& bodies )
+{
+	m_pairs.clear();
+	m_pair_tests = 0u;
+
+	if ( bodies.size() < 2u )
+		return;
+
+	// check every body with the rest of bodies O(n^2)
+	for ( unsigned i = 0u; i < bodies.size() - 1u; i++ )
+	{
+		for ( unsigned j = i + 1u; j < bodies.size(); j++ )
+		{
+			m_pairs.push_back( BodyPair{ i, j } );
+			m_pair_tests++;
+		}
+	}
+}
+
+/**
+* @brief clear the broadphase
+*/
+void BroadphaseBruteForce::clear()
+{
+	m_pairs.clear();
+	m_pair_tests = 0u;
+}
+
+
+
+
+/**
+* @brief create a broadphase of the given type
+* @param type
+* @return broadphase (owned by the caller)
+*/
+Broadphase* create_broadphase( const BroadphaseType type )
+{
+	switch ( type )
+	{
+	case BroadphaseType::Tree:
+		return new BroadphaseTree;
+	case BroadphaseType::SweepAndPrune:
+		return new BroadphaseSAP;
+	case BroadphaseType::Grid:
+		return new BroadphaseGrid;
+	case BroadphaseType::BruteForce:
+	default:
+		return new BroadphaseBruteForce;
+	}
+}
+
+/**
+* @brief compute the world bounding box of a body from the local bounds of its mesh
+* @param body
+* @return bounding box
+*/
+AABB compute_aabb( const RigidBody& body )
+{
+	const vec3 local_center		= ( body.mesh->bounds_max() + body.mesh->bounds_min() ) * 0.5f;
+	const vec3 local_extents	= ( body.mesh->bounds_max() - body.mesh->bounds_min() ) * 0.5f;
+
+	// rotation and scale of the body
+	mat3 basis = glm::mat3_cast( body.rot );
+	mat3 abs_basis;
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		basis[i] *= body.scl[i];
+
+		// absolute value of the basis projects the local extents on the world axes
+		abs_basis[i] = glm::abs( basis[i] );
+	}
+
+	const vec3 center	= body.position + basis * local_center;
+	const vec3 extents	= abs_basis * local_extents;
+
+	return AABB{ center - extents, center + extents };
+}
+
+/**
+* @brief grow a bounding box in every direction
+* @param aabb
+* @param margin
+* @return fat bounding box
+*/
+AABB fatten_aabb( const AABB& aabb, const float margin )
+{
+	return AABB{ aabb.min - vec3( margin ), aabb.max + vec3( margin ) };
+}
+
+/**
+* @brief bounding box enclosing two bounding boxes
+* @param a
+* @param b
+* @return merged bounding box
+*/
+AABB merge_aabb( const AABB& a, const AABB& b )
+{
+	return AABB{ glm::min( a.min, b.min ), glm::max( a.max, b.max ) };
+}
+
+/**
+* @brief check if two bounding boxes overlap
+* @param a
+* @param b
+* @return the boxes overlap
+*/
+bool overlap_aabb( const AABB& a, const AABB& b )
+{
+	return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+		   a.min.y <= b.max.y && a.max.y >= b.min.y &&
+		   a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+/**
+* @brief check if a bounding box is completely inside another
+* @param outer
+* @param inner
+* @return inner is contained
+*/
+bool contains_aabb( const AABB& outer, const AABB& inner )
+{
+	return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+		   outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+
+/**
+* @brief surface area of a bounding box (cost metric of the tree)
+* @param aabb
+* @return area
+*/
+float aabb_area( const AABB& aabb )
+{
+	const vec3 d = aabb.max - aabb.min;
+	return 2.0f * ( d.x * d.y + d.y * d.z + d.z * d.x );
+}
+
+/**
+* @brief order pairs by the first body and then by the second
+*/
+bool operator<( const BodyPair& a, const BodyPair& b )
+{
+	return a.body_A < b.body_A || ( a.body_A == b.body_A && a.body_B < b.body_B );
+}
+
+/**
+* @brief compare two pairs
+*/
+bool operator==( const BodyPair& a, const BodyPair& b )
+{
+	return a.body_A == b.body_A && a.body_B == b.body_B;
+}
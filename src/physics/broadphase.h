@@ -0,0 +1,72 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: broadphase.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+
+#include "math_utils.h"
+#include <vector>
+
+struct AABB
+{
+	vec3 min;
+	vec3 max;
+};
+
+struct BodyPair
+{
+	unsigned body_A;	// index of the first body (always the lowest)
+	unsigned body_B;	// index of the second body
+};
+
+enum class BroadphaseType
+{
+	BruteForce,
+	Tree,
+	SweepAndPrune,
+	Grid,
+};
+
+class Broadphase
+{
+public:
+	virtual ~Broadphase() = default;
+
+	virtual void update( const std::vector<RigidBody>& bodies ) = 0;
+	virtual void clear() = 0;
+
+	const std::vector<BodyPair>&	pairs		() const;
+	unsigned						pair_tests	() const;
+
+protected:
+	std::vector<BodyPair>	m_pairs;			// candidate pairs for the narrowphase
+	unsigned				m_pair_tests{ 0u };	// bounding volume tests done in the last update
+};
+
+
+class BroadphaseBruteForce : public Broadphase
+{
+public:
+	void update( const std::vector<RigidBody>& bodies ) final;
+	void clear() final;
+};
+
+
+Broadphase* create_broadphase( const BroadphaseType type );
+
+AABB compute_aabb	( const RigidBody& body );
+AABB fatten_aabb	( const AABB& aabb, const float margin );
+AABB merge_aabb		( const AABB& a, const AABB& b );
+bool overlap_aabb	( const AABB& a, const AABB& b );
+bool contains_aabb	( const AABB& outer, const AABB& inner );
+float aabb_area		( const AABB& aabb );
+
+bool operator<( const BodyPair& a, const BodyPair& b );
+bool operator==( const BodyPair& a, const BodyPair& b );
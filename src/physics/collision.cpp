@@ -8,36 +8,82 @@ Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
 Creation date: 02/10/2020
 ----------------------------------------------------------------------------------------------------------*/
 #include "collision.h"
+#include "profiler.h"
+#include "simd.h"
+
+#include <limits>
 
-#include "graphics.h"
 
 std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, const vec3& b0, const vec3& b1 );
+unsigned combine_features( const unsigned a, const unsigned b, const unsigned c );
+static float face_distance( const FlatFace& face_A, const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const Transform& trs, const Transform& inv_trs, unsigned& hint );
+
+static const unsigned no_support = std::numeric_limits<unsigned>::max();	// hill climbing from the first face
 
 /**
-* @brief check if to bodies collide
+* @brief	check if to bodies collide. The axis that separated the pair in the last query is
+*			tested first, the full query only runs when it does not separate the bodies anymore
 * @param body_A
 * @param body_B
+* @param cached_axis	last separating axis of the pair, updated with the new one (optional)
+* @param transform		transformations of the pair from the cache of the step (optional, otherwise
+*						built from the bodies)
 * @return contact_data	contact manifold of the collision
 * @return the bodies are colliding
 */
-bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data )
+bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, SeparatingAxis* cached_axis, const PairTransform* transform )
 {
 	const float epsilon = 0.005f;
 
+	const PairTransform pair = transform != nullptr ? *transform : make_pair_transform( body_A, body_B );
+	const PairTransform swapped = swap_pair_transform( pair );
+
+	if ( cached_axis != nullptr )
+	{
+		if ( cached_axis->type != SeparatingAxisType::None && is_separating_axis( body_A, body_B, *cached_axis, pair ) )
+		{
+			cached_axis->hit = true;
+			return false;
+		}
+		cached_axis->type = SeparatingAxisType::None;
+	}
+
 	// all faces of polygon A
-	ContactFace contact_A = has_separating_axis_face( body_A, body_B );
+	ContactFace contact_A = has_separating_axis_face( body_A, body_B, pair, cached_axis != nullptr ? &cached_axis->supports_A : nullptr );
 	if ( contact_A.separation > 0.0f )
+	{
+		if ( cached_axis != nullptr )
+		{
+			cached_axis->type = SeparatingAxisType::FaceA;
+			cached_axis->face_id = contact_A.face_id;
+		}
 		return false;
+	}
 
 	// all faces of polygon B
-	ContactFace contact_B = has_separating_axis_face( body_B, body_A );
+	ContactFace contact_B = has_separating_axis_face( body_B, body_A, swapped, cached_axis != nullptr ? &cached_axis->supports_B : nullptr );
 	if ( contact_B.separation > 0.0f )
+	{
+		if ( cached_axis != nullptr )
+		{
+			cached_axis->type = SeparatingAxisType::FaceB;
+			cached_axis->face_id = contact_B.face_id;
+		}
 		return false;
+	}
 
 	// all edges of A and B
-	ContactEdge contact_edge = has_separating_axis_edge(body_A, body_B);
+	ContactEdge contact_edge = has_separating_axis_edge( body_A, body_B, pair );
 	if ( contact_edge.separation > 0.0f )
+	{
+		if ( cached_axis != nullptr )
+		{
+			cached_axis->type = SeparatingAxisType::Edge;
+			cached_axis->edge_A = contact_edge.edge_A;
+			cached_axis->edge_B = contact_edge.edge_B;
+		}
 		return false;
+	}
 
 	if ( contact_A.separation == -std::numeric_limits<float>::max() && 
 		 contact_B.separation == -std::numeric_limits<float>::max() &&
@@ -63,13 +109,13 @@ bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact
 	switch ( collision_case )
 	{
 	case 0:
-		contact_data = get_contact_manifold( body_A, body_B, contact_A );
+		contact_data = get_contact_manifold( body_A, body_B, contact_A, pair );
 		break;
 	case 1:
-		contact_data = get_contact_manifold( body_B, body_A, contact_B );
+		contact_data = get_contact_manifold( body_B, body_A, contact_B, swapped );
 		break;
 	case 2:
-		contact_data = get_contact_manifold( body_A, body_B, contact_edge );
+		contact_data = get_contact_manifold( body_A, body_B, contact_edge, pair );
 		break;
 	}
 
@@ -80,41 +126,54 @@ bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact
 * @brief check if there is any separating axis between faces and vertices
 * @param body_A		body to check faces
 * @param body_B		body to check vertices
+* @param supports	support vertex of B for every face of A in the last query, the start of the
+*					hill climbing, updated (optional, otherwise the one of the previous face)
 * @return there is a separating axis
 */
-ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B )
+ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B, std::vector<unsigned>* supports )
 {
-	ContactFace contact;
+	return has_separating_axis_face( body_A, body_B, make_pair_transform( body_A, body_B ), supports );
+}
 
-	// transformation matrices of the bodies
-	const mat4 trs_A = body_A.model();
-	const mat4 trs_B = body_B.model();
+/**
+* @brief check if there is any separating axis between faces and vertices
+* @param body_A		body to check faces
+* @param body_B		body to check vertices
+* @param transform	transformations of the pair
+* @param supports	support vertex of B for every face of A in the last query, the start of the
+*					hill climbing, updated (optional, otherwise the one of the previous face)
+* @return there is a separating axis
+*/
+ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform, std::vector<unsigned>* supports )
+{
+	PROFILE_SCOPE( ProfilePhase::SatFaces );
+
+	ContactFace contact;
 
 	// transformation from body A space to body B space and inverse
-	const mat4 trs		= inverse( trs_B ) * trs_A;
-	const mat4 inv_trs	= inverse( trs );
+	const Transform& trs		= transform.A_to_B;
+	const Transform& inv_trs	= transform.B_to_A;
 
 	// half edge meshes of the bodies
 	auto mesh_A = body_A.mesh;
 	auto mesh_B = body_B.mesh;
 
-	// for every face in body A
-	for ( unsigned i = 0u; i < mesh_A->faces().size(); i++ )
-	{
-		auto& face_A = mesh_A->faces()[i];
+	const std::vector<FlatFace>& faces_A = mesh_A->flat_faces();
 
-		// normal of face A in B space
-		vec3 dir = vec3( trs * vec4( -face_A->m_normal, 0.0f ) );
+	if ( supports != nullptr && supports->size() != faces_A.size() )
+		supports->assign( faces_A.size(), no_support );
 
-		// get the support point of B given the direction
-		vec3 support_B = mesh_B->hill_climbing( dir );
+	// for every face in body A
+	unsigned support = no_support;
+	for ( unsigned i = 0u; i < faces_A.size(); i++ )
+	{
+		if ( supports != nullptr && ( *supports )[i] != no_support )
+			support = ( *supports )[i];
 
-		// transform the obtained point to A space
-		vec3 support = vec3( inv_trs * vec4( support_B, 1.0f ) );
+		float dist = face_distance( faces_A[i], mesh_A, mesh_B, trs, inv_trs, support );
 
-		// compute the distance from the point to the face
-		vec3 v = support - mesh_A->vertices()[face_A->m_vertices[0]];
-		float dist = dot( v, face_A->m_normal );
+		if ( supports != nullptr )
+			( *supports )[i] = support;
 
 		if ( dist > contact.separation )
 		{
@@ -133,36 +192,426 @@ ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody&
 }
 
 /**
-* @brief check if there is any separating axis between edges
+* @brief	check if a single axis still separates two bodies, a face of one of them or the
+*			cross product of two edges that must still build a minkowski face
+* @param body_A
+* @param body_B
+* @param axis	axis found by the last query of the pair, its support vertices are updated
+* @return the axis separates the bodies
+*/
+bool is_separating_axis( const RigidBody& body_A, const RigidBody& body_B, SeparatingAxis& axis )
+{
+	return is_separating_axis( body_A, body_B, axis, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief	check if a single axis still separates two bodies, a face of one of them or the
+*			cross product of two edges that must still build a minkowski face
+* @param body_A
+* @param body_B
+* @param axis		axis found by the last query of the pair, its support vertices are updated
+* @param transform	transformations of the pair
+* @return the axis separates the bodies
+*/
+bool is_separating_axis( const RigidBody& body_A, const RigidBody& body_B, SeparatingAxis& axis, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::SatCache );
+
+	switch ( axis.type )
+	{
+	case SeparatingAxisType::FaceA:
+		return face_separation( body_A, body_B, axis.face_id, axis.supports_A, transform ) > 0.0f;
+	case SeparatingAxisType::FaceB:
+		return face_separation( body_B, body_A, axis.face_id, axis.supports_B, swap_pair_transform( transform ) ) > 0.0f;
+	case SeparatingAxisType::Edge:
+		return create_minkowski_face( axis.edge_A, axis.edge_B, body_A, body_B, transform ) &&
+			   edge_distance( axis.edge_A, axis.edge_B, body_A, body_B, transform ) > 0.0f;
+	default:
+		return false;
+	}
+}
+
+/**
+* @brief distance from a face to the deepest vertex of the other body along its antinormal
+* @param face_A
+* @param mesh_A
+* @param mesh_B
+* @param trs		transformation from body A space to body B space
+* @param inv_trs
+* @param hint		vertex of B to start the hill climbing, replaced by the support vertex
+* @return distance, positive if the face separates the bodies
+*/
+static float face_distance( const FlatFace& face_A, const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const Transform& trs, const Transform& inv_trs, unsigned& hint )
+{
+	// normal of face A in B space
+	vec3 dir = trs.vector( -face_A.normal );
+
+	// get the support point of B given the direction
+	unsigned steps = 0u;
+	hint = mesh_B->support( dir, hint, &steps );
+	vec3 support_B = mesh_B->vertices()[hint];
+
+	PROFILE_COUNT( ProfileCounter::SupportQueries, 1u );
+	PROFILE_COUNT( ProfileCounter::SupportSteps, steps );
+
+	// transform the obtained point to A space
+	vec3 support = inv_trs.point( support_B );
+
+	// compute the distance from the point to the face
+	vec3 v = support - mesh_A->vertices()[mesh_A->face_vertices()[face_A.first_vertex]];
+	return dot( v, face_A.normal );
+}
+
+/**
+* @brief distance between a face of body A and body B
+* @param body_A		body of the face
+* @param body_B		body to check vertices
+* @param face_id
+* @param supports	support vertex of B for every face of A in the last query, updated
+* @return distance, positive if the face separates the bodies
+*/
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id, std::vector<unsigned>& supports )
+{
+	return face_separation( body_A, body_B, face_id, supports, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief distance between a face of body A and body B
+* @param body_A		body of the face
+* @param body_B		body to check vertices
+* @param face_id
+* @param supports	support vertex of B for every face of A in the last query, updated
+* @param transform	transformations of the pair
+* @return distance, positive if the face separates the bodies
+*/
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id, std::vector<unsigned>& supports, const PairTransform& transform )
+{
+	if ( supports.size() != body_A.mesh->flat_faces().size() )
+		supports.assign( body_A.mesh->flat_faces().size(), no_support );
+
+	return face_distance( body_A.mesh->flat_faces()[face_id], body_A.mesh, body_B.mesh, transform.A_to_B, transform.B_to_A, supports[face_id] );
+}
+
+/**
+* @brief distance between a face of body A and body B
+* @param body_A		body of the face
+* @param body_B		body to check vertices
+* @param face_id
+* @return distance, positive if the face separates the bodies
+*/
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id )
+{
+	std::vector<unsigned> supports;
+	return face_separation( body_A, body_B, face_id, supports );
+}
+
+// unique edge of a body in the frame of the edge query
+struct QueryEdge
+{
+	vec3 head;
+	vec3 direction;
+	vec3 normal_A;
+	vec3 normal_B;
+	vec3 arc;			// normal_B x normal_A, direction of the arc of the edge in the gauss map
+
+	unsigned edge;		// flat index of the half edge
+};
+
+/**
+* @brief transform the unique edges of a body to the frame of the edge query
+* @param mesh
+* @param model		model to world transformation of the body
+* @param origin		origin of the frame in world coordinates
+* @param sign		-1 to negate the normals, the gauss map of -B for the minkowski difference
+* @param edges		transformed edges
+*/
+static void transform_edges( const HalfEdgeMesh* mesh, const Transform& model, const vec3& origin, const float sign, std::vector<QueryEdge>& edges )
+{
+	const mat3& linear = model.linear;
+	const vec3 translation = model.translation - origin;
+
+	const std::vector<UniqueEdge>& unique_edges = mesh->unique_edges();
+	edges.resize( unique_edges.size() );
+
+	for ( unsigned i = 0u; i < unique_edges.size(); i++ )
+	{
+		const UniqueEdge& unique = unique_edges[i];
+		QueryEdge& edge = edges[i];
+
+		edge.head = linear * unique.head + translation;
+		edge.direction = normalize( linear * unique.direction );
+		edge.normal_A = linear * unique.normal_A * sign;
+		edge.normal_B = linear * unique.normal_B * sign;
+		edge.arc = cross( edge.normal_B, edge.normal_A );
+		edge.edge = unique.edge;
+	}
+}
+
+/**
+* @brief	check if there is any separating axis between edges. The unique edges of both bodies
+*			are transformed once to a frame with the orientation of the world and the origin
+*			in the center of A, then every pair is tested over the flat arrays one at a time.
+*			Reference of the wide query
+* @param body_A		body to check faces
+* @param body_B		body to check vertices
+* @return there is a separating axis
+*/
+ContactEdge has_separating_axis_edge_scalar( const RigidBody& body_A, const RigidBody& body_B )
+{
+	return has_separating_axis_edge_scalar( body_A, body_B, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief check if there is any separating axis between edges, one pair at a time
+* @param body_A		body to check faces
+* @param body_B		body to check vertices
+* @param transform	transformations of the pair
+* @return there is a separating axis
+*/
+ContactEdge has_separating_axis_edge_scalar( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform )
+{
+	ContactEdge contact;
+
+	// reused by every query of the thread
+	static thread_local std::vector<QueryEdge> edges_A;
+	static thread_local std::vector<QueryEdge> edges_B;
+
+	transform_edges( body_A.mesh, transform.model_A, transform.model_A.translation, 1.0f, edges_A );
+	transform_edges( body_B.mesh, transform.model_B, transform.model_A.translation, -1.0f, edges_B );
+
+	for ( const QueryEdge& edge_A : edges_A )
+	{
+		for ( const QueryEdge& edge_B : edges_B )
+		{
+			// the arcs intersect in the gauss map, same as is_minkowski_face
+			const float cba = dot( edge_A.arc, edge_B.normal_A );
+			const float dba = dot( edge_A.arc, edge_B.normal_B );
+			const float adc = dot( edge_B.arc, edge_A.normal_A );
+			const float bdc = dot( edge_B.arc, edge_A.normal_B );
+
+			if ( cba * dba >= 0.0f || adc * bdc >= 0.0f || cba * bdc <= 0.0f )
+				continue;
+
+			// parallel edges are separated by the faces
+			vec3 normal = cross( edge_A.direction, edge_B.direction );
+			const float length = glm::length( normal );
+			if ( length < 1e-5f )
+				continue;
+
+			// pointing from A to B
+			normal /= length;
+			if ( dot( normal, edge_A.head ) < 0.0f )
+				normal = -normal;
+
+			const float dist = dot( normal, edge_B.head - edge_A.head );
+			if ( dist > contact.separation )
+			{
+				contact.separation = dist;
+				contact.edge_A = edge_A.edge;
+				contact.edge_B = edge_B.edge;
+
+				if ( dist > 0.0f )
+					return contact;
+			}
+		}
+	} // O(n*m) unique edges
+
+	return contact;
+}
+
+// simd_width edges of body B, one per lane
+struct alignas( 32 ) WideEdges
+{
+	float head[3][simd_width];
+	float direction[3][simd_width];
+	float normal_A[3][simd_width];
+	float normal_B[3][simd_width];
+	float arc[3][simd_width];
+};
+
+/**
+* @brief copy a vec3 to a lane of the wide arrays
+*/
+static void set_lane( float ( &wide )[3][simd_width], const unsigned lane, const vec3& value )
+{
+	wide[0][lane] = value.x;
+	wide[1][lane] = value.y;
+	wide[2][lane] = value.z;
+}
+
+/**
+* @brief load the three components of a wide vector
+*/
+static WideVec3 load( const float ( &wide )[3][simd_width] )
+{
+	return { wide_load( wide[0] ), wide_load( wide[1] ), wide_load( wide[2] ) };
+}
+
+/**
+* @brief same vec3 in every lane
+*/
+static WideVec3 broadcast( const vec3& value )
+{
+	return { wide_set( value.x ), wide_set( value.y ), wide_set( value.z ) };
+}
+
+/**
+* @brief	transpose the edges to blocks of simd_width, the lanes after the last edge have
+*			null normals and never build a minkowski face
+* @param edges
+* @param wide
+*/
+static void pack_edges( const std::vector<QueryEdge>& edges, std::vector<WideEdges>& wide )
+{
+	wide.resize( ( edges.size() + simd_width - 1u ) / simd_width );
+
+	for ( unsigned block = 0u; block < wide.size(); block++ )
+	{
+		for ( unsigned lane = 0u; lane < simd_width; lane++ )
+		{
+			const unsigned i = block * simd_width + lane;
+			const bool empty = i >= edges.size();
+
+			set_lane( wide[block].head, lane, empty ? vec3( 0.0f ) : edges[i].head );
+			set_lane( wide[block].direction, lane, empty ? vec3( 0.0f ) : edges[i].direction );
+			set_lane( wide[block].normal_A, lane, empty ? vec3( 0.0f ) : edges[i].normal_A );
+			set_lane( wide[block].normal_B, lane, empty ? vec3( 0.0f ) : edges[i].normal_B );
+			set_lane( wide[block].arc, lane, empty ? vec3( 0.0f ) : edges[i].arc );
+		}
+	}
+}
+
+/**
+* @brief	check if there is any separating axis between edges. Same as the scalar query with
+*			every edge of A tested against simd_width edges of B at a time. The lanes that may
+*			improve the separation are visited in order, so the first separating pair is kept
 * @param body_A		body to check faces
 * @param body_B		body to check vertices
 * @return there is a separating axis
 */
 ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody& body_B )
 {
+	return has_separating_axis_edge( body_A, body_B, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief check if there is any separating axis between edges, simd_width edges of B at a time
+* @param body_A		body to check faces
+* @param body_B		body to check vertices
+* @param transform	transformations of the pair
+* @return there is a separating axis
+*/
+ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::SatEdges );
+
 	ContactEdge contact;
 
-	// half edge meshes of the bodies
-	auto mesh_A = body_A.mesh;
-	auto mesh_B = body_B.mesh;
+	// reused by every query of the thread
+	static thread_local std::vector<QueryEdge> edges_A;
+	static thread_local std::vector<QueryEdge> edges_B;
+	static thread_local std::vector<WideEdges> wide_B;
+
+	transform_edges( body_A.mesh, transform.model_A, transform.model_A.translation, 1.0f, edges_A );
+	transform_edges( body_B.mesh, transform.model_B, transform.model_A.translation, -1.0f, edges_B );
+	pack_edges( edges_B, wide_B );
+
+	const WideFloat zero = wide_set( 0.0f );
+	const WideFloat min_length2 = wide_set( 1e-10f );
+	const WideFloat lowest = wide_set( -std::numeric_limits<float>::max() );
+
+	alignas( 32 ) float distances[simd_width];
+
+	for ( const QueryEdge& edge_A : edges_A )
+	{
+		const WideVec3 head_A = broadcast( edge_A.head );
+		const WideVec3 direction_A = broadcast( edge_A.direction );
+		const WideVec3 normal_A = broadcast( edge_A.normal_A );
+		const WideVec3 normal_B = broadcast( edge_A.normal_B );
+		const WideVec3 arc_A = broadcast( edge_A.arc );
+
+		for ( unsigned block = 0u; block < wide_B.size(); block++ )
+		{
+			const WideEdges& edges = wide_B[block];
+
+			// the arcs intersect in the gauss map, same as is_minkowski_face
+			const WideVec3 arc_B = load( edges.arc );
+			const WideFloat cba = wide_dot( arc_A, load( edges.normal_A ) );
+			const WideFloat dba = wide_dot( arc_A, load( edges.normal_B ) );
+			const WideFloat adc = wide_dot( arc_B, normal_A );
+			const WideFloat bdc = wide_dot( arc_B, normal_B );
+
+			WideFloat valid = wide_and( wide_less( cba * dba, zero ), wide_less( adc * bdc, zero ) );
+			valid = wide_and( valid, wide_greater( cba * bdc, zero ) );
+
+			// most edges do not build a minkowski face
+			if ( wide_mask_bits( valid ) == 0u )
+				continue;
+
+			// parallel edges are separated by the faces
+			const WideVec3 normal = wide_cross( direction_A, load( edges.direction ) );
+			const WideFloat length2 = wide_dot( normal, normal );
+			valid = wide_and( valid, wide_greater( length2, min_length2 ) );
+
+			// pointing from A to B
+			const WideFloat dist = wide_dot( normal, load( edges.head ) - head_A ) / wide_sqrt( length2 );
+			const WideFloat oriented = wide_select( wide_less( wide_dot( normal, head_A ), zero ), -dist, dist );
+			const WideFloat separation = wide_select( valid, oriented, lowest );
+
+			if ( wide_mask_bits( wide_greater( separation, wide_set( contact.separation ) ) ) == 0u )
+				continue;
+
+			wide_store( distances, separation );
+			for ( unsigned lane = 0u; lane < simd_width; lane++ )
+			{
+				if ( distances[lane] > contact.separation )
+				{
+					contact.separation = distances[lane];
+					contact.edge_A = edge_A.edge;
+					contact.edge_B = edges_B[block * simd_width + lane].edge;
+
+					if ( distances[lane] > 0.0f )
+						return contact;
+				}
+			}
+		}
+	} // O(n*m/simd_width) unique edges
+
+	return contact;
+}
+
+/**
+* @brief	check if there is any separating axis between edges following the faces of the
+*			meshes, every edge is tested twice. Used to validate the unique edge query
+* @param body_A		body to check faces
+* @param body_B		body to check vertices
+* @return there is a separating axis
+*/
+ContactEdge has_separating_axis_edge_bruteforce( const RigidBody& body_A, const RigidBody& body_B )
+{
+	ContactEdge contact;
+
+	const PairTransform transform = make_pair_transform( body_A, body_B );
+
+	// faces of the meshes of the bodies, the edges of every face are consecutive
+	const std::vector<FlatFace>& faces_A = body_A.mesh->flat_faces();
+	const std::vector<FlatFace>& faces_B = body_B.mesh->flat_faces();
 
 	// for every face in body A
-	for ( auto face_A : mesh_A->faces() )
+	for ( const FlatFace& face_A : faces_A )
 	{
 		// for every face in body B
-		for ( auto face_B : mesh_B->faces() )
+		for ( const FlatFace& face_B : faces_B )
 		{
 			// for every edge in face A
-			auto edge_A = face_A->m_edge;
-			do
+			for ( unsigned edge_A = face_A.edge; edge_A < face_A.edge + face_A.vertex_count; edge_A++ )
 			{
 				// for every edge in face B
-				auto edge_B = face_B->m_edge;
-				do
+				for ( unsigned edge_B = face_B.edge; edge_B < face_B.edge + face_B.vertex_count; edge_B++ )
 				{
-					if ( create_minkowski_face( edge_A, edge_B, body_A, body_B ) )
+					if ( create_minkowski_face( edge_A, edge_B, body_A, body_B, transform ) )
 					{
-						float dist = edge_distance(edge_A, edge_B, body_A, body_B);
+						float dist = edge_distance( edge_A, edge_B, body_A, body_B, transform );
 						if ( dist > contact.separation )
 						{
 							contact.separation = dist;
@@ -173,12 +622,8 @@ ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody&
 								return contact;
 						}
 					}
-					
-					edge_B = edge_B->next;
-				} while ( edge_B != face_B->m_edge );
-
-				edge_A = edge_A->next;
-			} while ( edge_A != face_A->m_edge );
+				}
+			}
 		}
 	} // O(n*m * p*q)
 
@@ -187,27 +632,42 @@ ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody&
 
 /**
 * @brief build a minkowski face given two edges
-* @param edge_A
-* @param edge_B
-* @param trs_A	transformation matrix from body A to world coordinates
-* @param trs_B	transformation matrix from body B to world coordinates
+* @param edge_A		flat edge index of body A
+* @param edge_B		flat edge index of body B
+* @param body_A
+* @param body_B
+* @return the edges create a minkowski face
+*/
+bool create_minkowski_face( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B )
+{
+	return create_minkowski_face( edge_A, edge_B, body_A, body_B, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief build a minkowski face given two edges
+* @param edge_A		flat edge index of body A
+* @param edge_B		flat edge index of body B
+* @param body_A
+* @param body_B
+* @param transform	transformations of the pair
 * @return the edges create a minkowski face
 */
-bool create_minkowski_face( const HalfEdge* edge_A, const HalfEdge* edge_B, const RigidBody& body_A, const RigidBody& body_B )
+bool create_minkowski_face( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform )
 {
-	// transformation matrices of the bodies
-	const mat4 trs_A = body_A.model();
-	const mat4 trs_B = body_B.model();
+	const std::vector<FlatEdge>& edges_A = body_A.mesh->flat_edges();
+	const std::vector<FlatEdge>& edges_B = body_B.mesh->flat_edges();
+	const std::vector<FlatFace>& faces_A = body_A.mesh->flat_faces();
+	const std::vector<FlatFace>& faces_B = body_B.mesh->flat_faces();
 
-	vec3 a = edge_A->face->m_normal;
-	vec3 b = edge_A->twin->face->m_normal;
-	vec3 c = edge_B->face->m_normal;
-	vec3 d = edge_B->twin->face->m_normal;
+	vec3 a = faces_A[edges_A[edge_A].face].normal;
+	vec3 b = faces_A[edges_A[edges_A[edge_A].twin].face].normal;
+	vec3 c = faces_B[edges_B[edge_B].face].normal;
+	vec3 d = faces_B[edges_B[edges_B[edge_B].twin].face].normal;
 
-	a = vec3( trs_A * vec4( a, 0.0f ) );
-	b = vec3( trs_A * vec4( b, 0.0f ) );
-	c = vec3( trs_B * vec4( c, 0.0f ) );
-	d = vec3( trs_B * vec4( d, 0.0f ) );
+	a = transform.model_A.vector( a );
+	b = transform.model_A.vector( b );
+	c = transform.model_B.vector( c );
+	d = transform.model_B.vector( d );
 
 	return is_minkowski_face( a, b, -c, -d );
 }
@@ -236,26 +696,41 @@ bool is_minkowski_face( const vec3 a, const vec3 b, const vec3 c, const vec3 d )
 
 /**
 * @brief return the distance between two edges
-* @param edge_A
-* @param edge_B
-* @param trs_A	transformation matrix from body A to world coordinates
-* @param trs_B	transformation matrix from body B to world coordinates
+* @param edge_A		flat edge index of body A
+* @param edge_B		flat edge index of body B
+* @param body_A
+* @param body_B
 * @return distance between edges
 */
-float edge_distance( const HalfEdge* edge_A, const HalfEdge* edge_B, const RigidBody& body_A, const RigidBody& body_B )
+float edge_distance( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B )
 {
-	// transformation matrices of the bodies
-	const mat4 trs_A = body_A.model();
-	const mat4 trs_B = body_B.model();
+	return edge_distance( edge_A, edge_B, body_A, body_B, make_pair_transform( body_A, body_B ) );
+}
 
-	// vertices of the meshes
-	auto vertices_A = body_A.mesh->vertices();
-	auto vertices_B = body_B.mesh->vertices();
+/**
+* @brief return the distance between two edges
+* @param edge_A		flat edge index of body A
+* @param edge_B		flat edge index of body B
+* @param body_A
+* @param body_B
+* @param transform	transformations of the pair
+* @return distance between edges
+*/
+float edge_distance( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform )
+{
+	const Transform& trs_A = transform.model_A;
+	const Transform& trs_B = transform.model_B;
 
-	vec3 point_A = vec3( trs_A * vec4( vertices_A[edge_A->vertex], 1.0f ) );
-	vec3 point_B = vec3( trs_B * vec4( vertices_B[edge_B->vertex], 1.0f ) );
-	vec3 dir_A = normalize( point_A - vec3( trs_A * vec4( vertices_A[edge_A->prev->vertex], 1.0f ) ) );
-	vec3 dir_B = normalize( point_B - vec3( trs_B * vec4( vertices_B[edge_B->prev->vertex], 1.0f ) ) );
+	// vertices and edges of the meshes
+	const auto& vertices_A = body_A.mesh->vertices();
+	const auto& vertices_B = body_B.mesh->vertices();
+	const std::vector<FlatEdge>& edges_A = body_A.mesh->flat_edges();
+	const std::vector<FlatEdge>& edges_B = body_B.mesh->flat_edges();
+
+	vec3 point_A = trs_A.point( vertices_A[edges_A[edge_A].vertex] );
+	vec3 point_B = trs_B.point( vertices_B[edges_B[edge_B].vertex] );
+	vec3 dir_A = normalize( point_A - trs_A.point( vertices_A[edges_A[edges_A[edge_A].prev].vertex] ) );
+	vec3 dir_B = normalize( point_B - trs_B.point( vertices_B[edges_B[edges_B[edge_B].prev].vertex] ) );
 
 	// parallel edges
 	if ( std::abs( dot( dir_A, dir_B ) ) == 1.0f )
@@ -263,7 +738,7 @@ float edge_distance( const HalfEdge* edge_A, const HalfEdge* edge_B, const Rigid
 
 	vec3 normal = normalize( cross( dir_A, dir_B ) );
 
-	if ( dot( normal, point_A - body_A.position ) < 0.0f )
+	if ( dot( normal, point_A - trs_A.translation ) < 0.0f )
 		normal = -normal;
 
 	return dot( normal, point_B - point_A );
@@ -279,46 +754,82 @@ float edge_distance( const HalfEdge* edge_A, const HalfEdge* edge_B, const Rigid
 */
 ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, ContactFace& incident_contact )
 {
+	return get_contact_manifold( body_A, body_B, incident_contact, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief get the contact points from the overlapped face
+* @param body_A		body with reference face
+* @param body_B		body with incident face
+* @param reference_face_index
+* @param transform	transformations of the pair
+* @return contact manifold
+*/
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, ContactFace& incident_contact, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Clipping );
+
+	// flat storage of the meshes
+	const std::vector<FlatEdge>& edges_A = body_A.mesh->flat_edges();
+	const std::vector<FlatFace>& faces_A = body_A.mesh->flat_faces();
+	const std::vector<FlatFace>& faces_B = body_B.mesh->flat_faces();
+	const std::vector<unsigned>& face_vertices_A = body_A.mesh->face_vertices();
+	const std::vector<unsigned>& face_vertices_B = body_B.mesh->face_vertices();
+
 	// relevant faces
-	HalfEdgeFace* reference = body_A.mesh->faces()[incident_contact.face_id];
-	HalfEdgeFace* incident;
+	const FlatFace& reference = faces_A[incident_contact.face_id];
 
-	// transformation matrices
-	const mat4 trs_A = body_A.model();
-	const mat4 trs_B = body_B.model();
-	const mat4 inv_trs_B = inverse( trs_B );
+	// transformations
+	const Transform& trs_A = transform.model_A;
+	const Transform& trs_B = transform.model_B;
 
 	// antinormal vecetor
-	vec3 antinormal = normalize( vec3( trs_A * vec4( -reference->m_normal, 0.0f ) ) );
+	vec3 antinormal = normalize( trs_A.vector( -reference.normal ) );
 
 	// get the most opposite face from body B
 	float max_dot = -1.0f;
-	for ( HalfEdgeFace* face : body_B.mesh->faces() )
+	unsigned incident_id = 0u;
+	for ( unsigned i = 0u; i < faces_B.size(); i++ )
 	{
-		vec3 normal = vec3( trs_B * vec4( face->m_normal, 0.0f ) );
+		vec3 normal = trs_B.vector( faces_B[i].normal );
 		float dot = glm::dot( antinormal, normal );
 		if ( dot > max_dot )
 		{
 			max_dot = dot;
-			incident = face;
+			incident_id = i;
 		}
 	} // O(n)
 
-	// copy the vertices of the face in world coordinates
-	std::vector<vec3> face_points;
-	std::vector<vec3> contact_points;
+	// copy the vertices of the face in world coordinates, reused by every query of the thread
+	static thread_local std::vector<vec3> face_points;
+	static thread_local std::vector<vec3> contact_points;
 
-	for ( unsigned i = 0u; i < incident->m_vertices.size(); i++ )
-		face_points.push_back( vec3( trs_B * vec4( body_B.mesh->vertices()[incident->m_vertices[i]], 1.0f ) ) );
+	// features of the points, the vertices of the incident face or the clipping that created them
+	static thread_local std::vector<unsigned> face_features;
+	static thread_local std::vector<unsigned> contact_features;
 
+	face_points.clear();
+	contact_points.clear();
+	face_features.clear();
+	contact_features.clear();
 
-	HalfEdge* edge_it = reference->m_edge;
+	const FlatFace& incident = faces_B[incident_id];
+	for ( unsigned i = 0u; i < incident.vertex_count; i++ )
+	{
+		const unsigned vertex = face_vertices_B[incident.first_vertex + i];
+		face_points.push_back( trs_B.point( body_B.mesh->vertices()[vertex] ) );
+		face_features.push_back( vertex );
+	}
+
+
+	unsigned edge_it = reference.edge;
+	unsigned plane_id = 0u;
 	do
 	{
-		HalfEdgeFace* clipping_plane = edge_it->twin->face;
+		const FlatFace& clipping_plane = faces_A[edges_A[edges_A[edge_it].twin].face];
 		// normal and point in world coordinates
-		vec3 normal = vec3( trs_A * vec4( clipping_plane->m_normal, 0.0f ) );
-		vec3 point	= vec3( trs_A * vec4( body_A.mesh->vertices()[clipping_plane->m_vertices[0u]], 1.0f ) );
+		vec3 normal = trs_A.vector( clipping_plane.normal );
+		vec3 point	= trs_A.point( body_A.mesh->vertices()[face_vertices_A[clipping_plane.first_vertex]] );
 
 		// clip the vertices with the adjacent face
 		unsigned size = static_cast<unsigned>( face_points.size() );
@@ -332,11 +843,15 @@ ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, Cont
 			if ( t1 > 0.0f && t2 > 0.0f )
 				continue;
 			
+			// clipped points are identified by the segment and the plane
+			const unsigned clip_feature = combine_features( face_features[i], face_features[( i + 1u ) % size], plane_id );
+
 			// first point in, second point out
 			if ( t2 > 0.0f )
 			{
 				float t = -t1 / ( -t1 + t2 );
 				contact_points.push_back( ( face_points[( i + 1u ) % size] - face_points[i] ) * t + face_points[i] );
+				contact_features.push_back( clip_feature );
 			}
 			else
 			{
@@ -345,36 +860,50 @@ ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, Cont
 				{
 					float t = t1 / (t1 - t2);
 					contact_points.push_back( ( face_points[( i + 1u ) % size] - face_points[i] ) * t + face_points[i] );
+					contact_features.push_back( clip_feature );
 				}
 				// second point in
 				contact_points.push_back( face_points[( i + 1u ) % size] );
+				contact_features.push_back( face_features[( i + 1u ) % size] );
 			}
 		}
 
-		// save clipped points		
-		face_points = contact_points;
+		// save clipped points
+		face_points.swap( contact_points );
 		contact_points.clear();
+		face_features.swap( contact_features );
+		contact_features.clear();
 
-		edge_it = edge_it->next;
-	} while ( edge_it != reference->m_edge );
+		edge_it = edges_A[edge_it].next;
+		plane_id++;
+	} while ( edge_it != reference.edge );
 
 	// contact data
-	assert( glm::length2( reference->m_normal ) > 0.0f );
+	assert( glm::length2( reference.normal ) > 0.0f );
 	ContactManifold contact;
-	contact.normal = vec3( trs_A * vec4( reference->m_normal, 0.0f ) );
+	contact.normal = trs_A.vector( reference.normal );
+	contact.feature = incident_contact.face_id << 16u | incident_id;
 
 	// ignore points outside the reference face
-	for ( auto point : face_points )
+	static thread_local std::vector<ContactPoint> clipped;
+	clipped.clear();
+	for ( unsigned i = 0u; i < face_points.size(); i++ )
 	{
+		const vec3 point = face_points[i];
 		vec3 face_normal = contact.normal;
-		float penetration = distance_point_plane( point, face_normal, vec3( trs_A * vec4( body_A.mesh->vertices()[reference->m_vertices[0u]], 1.0f ) ) );
+		float penetration = distance_point_plane( point, face_normal, trs_A.point( body_A.mesh->vertices()[face_vertices_A[reference.first_vertex]] ) );
 		if ( penetration <= 0.0f )
 		{
 			vec3 point_A = point - penetration * face_normal;
-			contact.points.push_back( ContactPoint{ point_A, point, -penetration } );
+			clipped.push_back( ContactPoint{ point_A, point, -penetration, 0.0f, 0.0f, face_features[i] } );
 		}
 	}
 
+	// every clipped point fits, reduce_manifold drops and counts the ones the solver does not need
+	assert( clipped.size() <= max_manifold_points );
+	for ( const ContactPoint& point : clipped )
+		contact.points.push_back( point );
+
 	contact.body_A = &body_A;
 	contact.body_B = &body_B;
 
@@ -390,26 +919,44 @@ ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, Cont
 */
 ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const ContactEdge& contact_info )
 {
-	const HalfEdge* edge_A = contact_info.edge_A;
-	const HalfEdge* edge_B = contact_info.edge_B;
+	return get_contact_manifold( body_A, body_B, contact_info, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief get the contact points from the overlapping edges
+* @param edge_A		edge of body A
+* @param edge_B		edge of body B
+* @param transform	transformations of the pair
+* @return contact manifold
+*/
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const ContactEdge& contact_info, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Clipping );
 
 	ContactManifold contact;
 
-	if ( edge_A == nullptr )
+	if ( contact_info.edge_A == no_edge )
 		return contact;
 
-	// transformation matrices
-	const mat4 trs_A = body_A.model();
-	const mat4 trs_B = body_B.model();
+	const FlatEdge& edge_A = body_A.mesh->flat_edges()[contact_info.edge_A];
+	const FlatEdge& edge_B = body_B.mesh->flat_edges()[contact_info.edge_B];
+
+	// vertices at the tail of the edges
+	const unsigned tail_A = body_A.mesh->flat_edges()[edge_A.prev].vertex;
+	const unsigned tail_B = body_B.mesh->flat_edges()[edge_B.prev].vertex;
+
+	// transformations
+	const Transform& trs_A = transform.model_A;
+	const Transform& trs_B = transform.model_B;
 
 	const auto& vertices_A = body_A.mesh->vertices();
 	const auto& vertices_B = body_B.mesh->vertices();
 
 	// segment points
-	const vec3 a0 = vec3( trs_A * vec4( vertices_A[edge_A->prev->vertex], 1.0f ) );
-	const vec3 a1 = vec3( trs_A * vec4( vertices_A[edge_A->vertex], 1.0f ) );
-	const vec3 b0 = vec3( trs_B * vec4( vertices_B[edge_B->prev->vertex], 1.0f ) );
-	const vec3 b1 = vec3( trs_B * vec4( vertices_B[edge_B->vertex], 1.0f ) );
+	const vec3 a0 = trs_A.point( vertices_A[tail_A] );
+	const vec3 a1 = trs_A.point( vertices_A[edge_A.vertex] );
+	const vec3 b0 = trs_B.point( vertices_B[tail_B] );
+	const vec3 b1 = trs_B.point( vertices_B[edge_B.vertex] );
 
 	// contact points
 	const auto points = closest_points_segment( a0, a1, b0, b1 );
@@ -422,13 +969,137 @@ ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, cons
 	const float dist = -contact_info.separation;
 
 
-	contact.points.push_back( { points.first, points.second, dist } );
+	// edge contacts are identified by the vertices of both edges
+	const unsigned feature_A = combine_features( tail_A, edge_A.vertex, 0u );
+	const unsigned feature_B = combine_features( tail_B, edge_B.vertex, 0u );
+	contact.feature = combine_features( feature_A, feature_B, 1u );
+
+	contact.points.push_back( { points.first, points.second, dist, 0.0f, 0.0f, contact.feature } );
 	contact.body_A = &body_A;
 	contact.body_B = &body_B;
 
 	return contact;
 }
 
+/**
+* @brief	choose the deepest point of a manifold and the ones that span the largest area with it
+* @param points
+* @param count
+* @param normal		of the manifold
+* @param max_points	points chosen, up to 4
+* @param kept		indices of the chosen points
+* @return number of chosen points
+*/
+static unsigned select_points( const ContactPoint* points, const unsigned count, const vec3& normal, const unsigned max_points, unsigned ( &kept )[4] )
+{
+	const unsigned kept_count = glm::min( max_points, 4u );
+
+	// deepest point
+	kept[0] = 0u;
+	for ( unsigned i = 1u; i < count; i++ )
+		if ( points[i].depth > points[kept[0]].depth )
+			kept[0] = i;
+
+	// farthest from it
+	if ( kept_count > 1u )
+	{
+		float max_distance = -1.0f;
+		for ( unsigned i = 0u; i < count; i++ )
+		{
+			const float distance = glm::length2( points[i].point_A - points[kept[0]].point_A );
+			if ( distance > max_distance )
+			{
+				max_distance = distance;
+				kept[1] = i;
+			}
+		}
+	}
+
+	// largest triangle, signed around the normal so the fourth point can look on the other side
+	float triangle_sign = 1.0f;
+	if ( kept_count > 2u )
+	{
+		const vec3 a = points[kept[0]].point_A;
+		const vec3 b = points[kept[1]].point_A;
+
+		float max_area = -1.0f;
+		for ( unsigned i = 0u; i < count; i++ )
+		{
+			const float area = dot( cross( b - a, points[i].point_A - a ), normal );
+			if ( std::abs( area ) > max_area )
+			{
+				max_area = std::abs( area );
+				triangle_sign = area < 0.0f ? -1.0f : 1.0f;
+				kept[2] = i;
+			}
+		}
+	}
+
+	// the point that adds the most area out of an edge of the triangle
+	unsigned kept_size = glm::min( kept_count, 3u );
+	if ( kept_count > 3u )
+	{
+		float max_area = 0.0f;
+		for ( unsigned i = 0u; i < count; i++ )
+		{
+			for ( unsigned edge = 0u; edge < 3u; edge++ )
+			{
+				const vec3 a = points[kept[edge]].point_A;
+				const vec3 b = points[kept[( edge + 1u ) % 3u]].point_A;
+				const float area = -triangle_sign * dot( cross( b - a, points[i].point_A - a ), normal );
+				if ( area > max_area )
+				{
+					max_area = area;
+					kept[3] = i;
+					kept_size = 4u;
+				}
+			}
+		}
+	}
+
+	// degenerate manifolds repeat a point
+	unsigned unique_size = 0u;
+	for ( unsigned i = 0u; i < kept_size; i++ )
+	{
+		bool repeated = false;
+		for ( unsigned j = 0u; j < unique_size; j++ )
+			repeated = repeated || kept[j] == kept[i];
+		if ( repeated == false )
+			kept[unique_size++] = kept[i];
+	}
+
+	return unique_size;
+}
+
+/**
+* @brief	keep the deepest point of a manifold and the ones that span the largest area with it,
+*			the rest add solver rows without making the contact more stable
+* @param contact
+* @param max_points	points kept, up to 4
+* @return number of dropped points
+*/
+unsigned reduce_manifold( ContactManifold& contact, const unsigned max_points )
+{
+	const unsigned count = contact.points.size();
+	if ( count <= glm::min( max_points, 4u ) || max_points == 0u )
+		return 0u;
+
+	unsigned kept[4];
+	const unsigned kept_size = select_points( contact.points.begin(), count, contact.normal, max_points, kept );
+
+	ContactPoint points[4];
+	for ( unsigned i = 0u; i < kept_size; i++ )
+		points[i] = contact.points[kept[i]];
+
+	contact.points.clear();
+	for ( unsigned i = 0u; i < kept_size; i++ )
+		contact.points.push_back( points[i] );
+
+	const unsigned dropped = count - kept_size;
+	PROFILE_COUNT( ProfileCounter::DroppedContacts, dropped );
+	return dropped;
+}
+
 /**
 * @brief compute the distance from a point to a plane
 * @param point
@@ -441,6 +1112,18 @@ float distance_point_plane( const vec3& point, const vec3& plane_normal, const v
 	return dot( plane_normal, point - plane_point );
 }
 
+/**
+* @brief combine three feature ids into one
+* @param a
+* @param b
+* @param c
+* @return combined id
+*/
+unsigned combine_features( const unsigned a, const unsigned b, const unsigned c )
+{
+	return ( a * 73856093u ) ^ ( b * 19349663u ) ^ ( ( c + 1u ) * 83492791u );
+}
+
 /**
 * @brief closest points between two segments
 */
@@ -464,7 +1147,7 @@ std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, co
 	if ( a <= epsilon )
 	{
 		s = 0.0f;
-		t = clamp( f / e, 0.0f, 1.0f );
+		t = glm::clamp( f / e, 0.0f, 1.0f );
 	}
 	else
 	{
@@ -473,7 +1156,7 @@ std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, co
 		if ( e <= epsilon )
 		{
 			t = 0.0f;
-			s = clamp( -c / a, 0.0f, 1.0f );
+			s = glm::clamp( -c / a, 0.0f, 1.0f );
 		}
 		else
 		{
@@ -481,7 +1164,7 @@ std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, co
 			const float denom = a * e - b * b;
 
 			if ( denom != 0.0f )
-				s = clamp( ( b * f - c * e ) / denom, 0.0f, 1.0f );
+				s = glm::clamp( ( b * f - c * e ) / denom, 0.0f, 1.0f );
 			else
 				s = 0.0f;
 
@@ -490,12 +1173,12 @@ std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, co
 			if ( t < 0.0f )
 			{
 				t = 0.0f;
-				s = clamp( -c / a, 0.0f, 1.0f );
+				s = glm::clamp( -c / a, 0.0f, 1.0f );
 			}
 			else if ( t > 1.0f )
 			{
 				t = 1.0f;
-				s = clamp( ( b - c ) / a, 0.0f, 1.0f );
+				s = glm::clamp( ( b - c ) / a, 0.0f, 1.0f );
 			}
 		}
 	}
@@ -10,20 +10,37 @@ Creation date: 02/10/2020
 #include "rigid_body.h"
 #include "half_edge.h"
 #include "contact.h"
+#include "sat_cache.h"
+#include "transform.h"
 
 #include "math_utils.h"
 
 
-bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data );
+bool overlap_sat( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, SeparatingAxis* cached_axis = nullptr, const PairTransform* transform = nullptr );
+bool is_separating_axis( const RigidBody& body_A, const RigidBody& body_B, SeparatingAxis& axis );
+bool is_separating_axis( const RigidBody& body_A, const RigidBody& body_B, SeparatingAxis& axis, const PairTransform& transform );
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id );
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id, std::vector<unsigned>& supports );
+float face_separation( const RigidBody& body_A, const RigidBody& body_B, const unsigned face_id, std::vector<unsigned>& supports, const PairTransform& transform );
 
-ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B );
+ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B, std::vector<unsigned>* supports = nullptr );
+ContactFace has_separating_axis_face( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform, std::vector<unsigned>* supports = nullptr );
 ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody& body_B );
+ContactEdge has_separating_axis_edge( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform );
+ContactEdge has_separating_axis_edge_scalar( const RigidBody& body_A, const RigidBody& body_B );
+ContactEdge has_separating_axis_edge_scalar( const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform );
+ContactEdge has_separating_axis_edge_bruteforce( const RigidBody& body_A, const RigidBody& body_B );
 
-bool create_minkowski_face( const HalfEdge* edge_A, const HalfEdge* edge_B, const RigidBody& body_A, const RigidBody& body_B );
+bool create_minkowski_face( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B );
+bool create_minkowski_face( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform );
 bool is_minkowski_face( const vec3 a, const vec3 b, const vec3 c, const vec3 d );
-float edge_distance( const HalfEdge* edge_A, const HalfEdge* edge_B, const RigidBody& body_A, const RigidBody& body_B );
+float edge_distance( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B );
+float edge_distance( const unsigned edge_A, const unsigned edge_B, const RigidBody& body_A, const RigidBody& body_B, const PairTransform& transform );
 
 ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, ContactFace& contact );
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, ContactFace& contact, const PairTransform& transform );
 ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const ContactEdge& contact );
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const ContactEdge& contact, const PairTransform& transform );
+unsigned reduce_manifold( ContactManifold& contact, const unsigned max_points );
 
 float distance_point_plane( const vec3& point, const vec3& plane_normal, const vec3& plane_point );
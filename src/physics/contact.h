@@ -11,9 +11,9 @@ Creation date: 03/11/2020
 #pragma once
 
 #include "math_utils.h"
-#include <vector>
+#include "fixed_vector.h"
+#include "half_edge.h"
 
-struct HalfEdge;
 struct RigidBody;
 
 struct ContactFace
@@ -25,8 +25,8 @@ struct ContactFace
 struct ContactEdge
 {
 	float separation{ -std::numeric_limits<float>::max() };
-	HalfEdge* edge_A{ nullptr };
-	HalfEdge* edge_B{ nullptr };
+	unsigned edge_A{ no_edge };		// flat edge indices of the meshes
+	unsigned edge_B{ no_edge };
 };
 
 struct ContactPoint
@@ -36,16 +36,23 @@ struct ContactPoint
 	float	depth{ 0.0f };
 	float 	impulse{ 0.0f };
 	float	Jv0{ 0.0f };
+	unsigned feature{ 0u };		// features of the bodies that created the point
 };
 
+// clipped points kept in a manifold, an incident face clipped by a reference face has at most
+// the vertices of both
+const unsigned max_manifold_points = 2u * max_face_vertices;
+
 struct ContactManifold
 {
-	std::vector<ContactPoint> points;
+	FixedVector<ContactPoint, max_manifold_points> points;
 	vec3 normal;				// normal of separation in world space
 
 	RigidBody* body_A;
 	RigidBody* body_B;
 
+	unsigned feature{ 0u };		// reference and incident faces, or the two edges
+
 	float impulse_u{ 0.0f };
 	float impulse_v{ 0.0f };
 	float impulse_t{ 0.0f };
@@ -0,0 +1,146 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: contact_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "contact_cache.h"
+
+
+float ContactCache::warm_start_factor = 0.75f;
+
+
+/**
+* @brief key of the pair of bodies of a contact, independent of the order of the bodies
+* @param contact
+* @param bodies
+* @return key
+*/
+static unsigned long long pair_key( const ContactManifold& contact, const std::vector<RigidBody>& bodies )
+{
+	const unsigned long long a = static_cast<unsigned long long>( contact.body_A - bodies.data() );
+	const unsigned long long b = static_cast<unsigned long long>( contact.body_B - bodies.data() );
+
+	return a < b ? a << 32u | b : b << 32u | a;
+}
+
+/**
+* @brief	copy the impulses of the last step to the new contacts, only points created
+*			by the same features of the same faces or edges keep their impulse. The impulses
+*			are scaled down a bit so the position correction of the last step is not reapplied fully
+* @param contacts	contacts of the current step
+* @param bodies
+*/
+void ContactCache::warm_start( std::vector<ContactManifold>& contacts, const std::vector<RigidBody>& bodies )
+{
+	m_matched_points = 0u;
+
+	for ( ContactManifold& contact : contacts )
+	{
+		auto it = m_manifolds.find( pair_key( contact, bodies ) );
+		if ( it == m_manifolds.end() )
+			continue;
+
+		const CachedManifold& cached = it->second;
+
+		// the reference face or the edges changed
+		if ( cached.reference != static_cast<unsigned>( contact.body_A - bodies.data() ) || cached.feature != contact.feature )
+			continue;
+
+		// O(p^2) with at most a few points per manifold
+		unsigned matched = 0u;
+		for ( ContactPoint& point : contact.points )
+		{
+			for ( const CachedPoint& cached_point : cached.points )
+			{
+				if ( cached_point.feature == point.feature )
+				{
+					point.impulse = cached_point.impulse * warm_start_factor;
+					matched++;
+					break;
+				}
+			}
+		}
+		m_matched_points += matched;
+
+		// friction is applied at the center of the points, only valid if the points are the same
+		if ( matched == contact.points.size() && matched == cached.points.size() )
+		{
+			contact.impulse_u = cached.impulse_u * warm_start_factor;
+			contact.impulse_v = cached.impulse_v * warm_start_factor;
+			contact.impulse_t = cached.impulse_t * warm_start_factor;
+		}
+	}
+}
+
+/**
+* @brief	save the impulses of the solved contacts, pairs that stopped touching are removed
+*			while pairs of sleeping bodies are kept until they wake up
+* @param contacts	solved contacts of the current step
+* @param bodies
+*/
+void ContactCache::store( const std::vector<ContactManifold>& contacts, const std::vector<RigidBody>& bodies )
+{
+	m_step++;
+
+	for ( const ContactManifold& contact : contacts )
+	{
+		CachedManifold& cached = m_manifolds[pair_key( contact, bodies )];
+
+		cached.reference = static_cast<unsigned>( contact.body_A - bodies.data() );
+		cached.feature = contact.feature;
+		cached.impulse_u = contact.impulse_u;
+		cached.impulse_v = contact.impulse_v;
+		cached.impulse_t = contact.impulse_t;
+		cached.step = m_step;
+
+		cached.points.clear();
+		for ( const ContactPoint& point : contact.points )
+			cached.points.push_back( CachedPoint{ point.feature, point.impulse } );
+	}
+
+	// evict the pairs not in contact anymore
+	for ( auto it = m_manifolds.begin(); it != m_manifolds.end(); )
+	{
+		const unsigned a = static_cast<unsigned>( it->first >> 32u );
+		const unsigned b = static_cast<unsigned>( it->first & 0xffffffffu );
+
+		const bool removed = a >= bodies.size() || b >= bodies.size();
+		const bool sleeping = removed == false && bodies[a].is_awake() == false && bodies[b].is_awake() == false;
+
+		if ( it->second.step != m_step && ( removed || sleeping == false ) )
+			it = m_manifolds.erase( it );
+		else
+			it++;
+	}
+}
+
+/**
+* @brief remove every cached pair
+*/
+void ContactCache::clear()
+{
+	m_manifolds.clear();
+	m_matched_points = 0u;
+}
+
+/**
+* @brief get the number of cached pairs
+* @return pairs
+*/
+unsigned ContactCache::size() const
+{
+	return static_cast<unsigned>( m_manifolds.size() );
+}
+
+/**
+* @brief get the number of points warm started in the last step
+* @return points
+*/
+unsigned ContactCache::matched_points() const
+{
+	return m_matched_points;
+}
@@ -0,0 +1,57 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: contact_cache.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+
+#include <unordered_map>
+#include <vector>
+
+struct CachedPoint
+{
+	unsigned	feature;
+	float		impulse;
+};
+
+struct CachedManifold
+{
+	FixedVector<CachedPoint, max_manifold_points> points;
+
+	unsigned reference;		// body used as body A of the manifold
+	unsigned feature;
+
+	float impulse_u;
+	float impulse_v;
+	float impulse_t;
+
+	unsigned step;			// last step the pair was in contact
+};
+
+// impulses of the last step of every pair in contact, used to warm start the solver
+class ContactCache
+{
+public:
+	void warm_start	( std::vector<ContactManifold>& contacts, const std::vector<RigidBody>& bodies );
+	void store		( const std::vector<ContactManifold>& contacts, const std::vector<RigidBody>& bodies );
+	void clear		();
+
+	unsigned size			() const;
+	unsigned matched_points	() const;
+
+public:
+	static float warm_start_factor;		// fraction of the last impulses applied
+
+private:
+	std::unordered_map<unsigned long long, CachedManifold> m_manifolds;	// by pair of bodies
+
+	unsigned m_step{ 0u };
+	unsigned m_matched_points{ 0u };	// points warm started in the last step
+};
@@ -0,0 +1,335 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: dk_hierarchy.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "dk_hierarchy.h"
+
+#include <algorithm>
+#include <utility>
+
+
+// triangle of a convex hull being built, the normal points out of the hull
+struct HullFace
+{
+	unsigned a;
+	unsigned b;
+	unsigned c;
+
+	vec3	normal;
+	float	offset;		// dot( normal, point on the face )
+};
+
+/**
+* @brief create a face of the hull
+*/
+static HullFace make_face( const std::vector<vec3>& points, const unsigned a, const unsigned b, const unsigned c )
+{
+	const vec3 normal = normalize( cross( points[b] - points[a], points[c] - points[a] ) );
+	return HullFace{ a, b, c, normal, dot( normal, points[a] ) };
+}
+
+/**
+* @brief	incremental convex hull of some points, every point is added by removing the faces
+*			that see it and closing their horizon with new faces. Points on the surface of the
+*			hull are not added
+* @param points
+* @param subset		indices of the points in the hull
+* @param epsilon	distance to a face to see it
+* @return faces		triangles of the hull
+* @return the points are not coplanar
+*/
+static bool convex_hull( const std::vector<vec3>& points, const std::vector<unsigned>& subset, const float epsilon, std::vector<HullFace>& faces )
+{
+	faces.clear();
+	if ( subset.size() < 4u )
+		return false;
+
+	// a tetrahedron as big as possible, from the extremes in x
+	unsigned p0 = subset[0];
+	unsigned p1 = subset[0];
+	for ( unsigned index : subset )
+	{
+		if ( points[index].x < points[p0].x )
+			p0 = index;
+		if ( points[index].x > points[p1].x )
+			p1 = index;
+	}
+
+	unsigned p2 = p0;
+	float max_distance = 0.0f;
+	for ( unsigned index : subset )
+	{
+		const float distance = glm::length( cross( points[index] - points[p0], points[p1] - points[p0] ) );
+		if ( distance > max_distance )
+		{
+			max_distance = distance;
+			p2 = index;
+		}
+	}
+
+	const vec3 normal = cross( points[p1] - points[p0], points[p2] - points[p0] );
+	if ( p0 == p1 || glm::length( normal ) < epsilon )
+		return false;
+
+	unsigned p3 = p0;
+	max_distance = 0.0f;
+	for ( unsigned index : subset )
+	{
+		const float distance = std::abs( dot( normalize( normal ), points[index] - points[p0] ) );
+		if ( distance > max_distance )
+		{
+			max_distance = distance;
+			p3 = index;
+		}
+	}
+	if ( max_distance < epsilon )
+		return false;
+
+	// faces pointing away from the center
+	const vec3 center = ( points[p0] + points[p1] + points[p2] + points[p3] ) * 0.25f;
+	const unsigned tetrahedron[4][3] = { { p0, p1, p2 }, { p0, p3, p1 }, { p0, p2, p3 }, { p1, p3, p2 } };
+	for ( const auto& triangle : tetrahedron )
+	{
+		HullFace face = make_face( points, triangle[0], triangle[1], triangle[2] );
+		if ( dot( face.normal, center ) > face.offset )
+			face = make_face( points, triangle[0], triangle[2], triangle[1] );
+		faces.push_back( face );
+	}
+
+	std::vector<std::pair<unsigned, unsigned>> horizon;
+	for ( unsigned index : subset )
+	{
+		if ( index == p0 || index == p1 || index == p2 || index == p3 )
+			continue;
+
+		// remove the faces that see the point, their open edges are the horizon
+		horizon.clear();
+		auto add_edge = [&]( const unsigned a, const unsigned b )
+		{
+			for ( auto it = horizon.begin(); it != horizon.end(); it++ )
+			{
+				// shared by two removed faces
+				if ( it->first == b && it->second == a )
+				{
+					horizon.erase( it );
+					return;
+				}
+			}
+			horizon.push_back( { a, b } );
+		};
+
+		for ( unsigned i = 0u; i < faces.size(); )
+		{
+			const HullFace& face = faces[i];
+			if ( dot( face.normal, points[index] ) - face.offset > epsilon )
+			{
+				add_edge( face.a, face.b );
+				add_edge( face.b, face.c );
+				add_edge( face.c, face.a );
+
+				faces[i] = faces.back();
+				faces.pop_back();
+				continue;
+			}
+			i++;
+		}
+
+		// the horizon keeps the winding of the removed faces
+		for ( const auto& edge : horizon )
+			faces.push_back( make_face( points, edge.first, edge.second, index ) );
+	}
+
+	return true;
+}
+
+/**
+* @brief keep the vertices and the adjacency of a hull as a level
+* @param faces
+* @param vertex_count	vertices of the mesh
+* @return level
+*/
+static DkLevel make_level( const std::vector<HullFace>& faces, const unsigned vertex_count )
+{
+	// every edge in both directions, once
+	std::vector<std::pair<unsigned, unsigned>> edges;
+	for ( const HullFace& face : faces )
+	{
+		edges.push_back( { face.a, face.b } );
+		edges.push_back( { face.b, face.c } );
+		edges.push_back( { face.c, face.a } );
+		edges.push_back( { face.b, face.a } );
+		edges.push_back( { face.c, face.b } );
+		edges.push_back( { face.a, face.c } );
+	}
+	std::sort( edges.begin(), edges.end() );
+	edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+
+	DkLevel level;
+	level.offsets.assign( vertex_count + 1u, 0u );
+	for ( const auto& edge : edges )
+		level.offsets[edge.first + 1u]++;
+	for ( unsigned i = 0u; i < vertex_count; i++ )
+	{
+		if ( level.offsets[i + 1u] != 0u )
+			level.vertices.push_back( i );
+		level.offsets[i + 1u] += level.offsets[i];
+	}
+
+	// sorted by the first vertex, the neighbors of each vertex are contiguous
+	level.neighbors.reserve( edges.size() );
+	for ( const auto& edge : edges )
+		level.neighbors.push_back( edge.second );
+
+	return level;
+}
+
+/**
+* @brief	build the levels, each one removes from the previous hull a set of vertices with few
+*			neighbors where no two of them are adjacent, until the hull is small
+* @param vertices
+* @return the vertices build a hull, flat meshes have no hierarchy
+*/
+bool DkHierarchy::build( const std::vector<vec3>& vertices )
+{
+	clear();
+
+	vec3 min = vertices.empty() ? vec3( 0.0f ) : vertices[0];
+	vec3 max = min;
+	for ( const vec3& vertex : vertices )
+	{
+		min = glm::min( min, vertex );
+		max = glm::max( max, vertex );
+	}
+	const float epsilon = 1e-5f * glm::max( glm::max( max.x - min.x, max.y - min.y ), glm::max( max.z - min.z, 1e-6f ) );
+
+	std::vector<unsigned> subset( vertices.size() );
+	for ( unsigned i = 0u; i < subset.size(); i++ )
+		subset[i] = i;
+
+	std::vector<HullFace> faces;
+	if ( convex_hull( vertices, subset, epsilon, faces ) == false )
+		return false;
+	m_levels.push_back( make_level( faces, static_cast<unsigned>( vertices.size() ) ) );
+
+	while ( m_levels.back().vertices.size() > top_vertex_count )
+	{
+		const DkLevel& level = m_levels.back();
+
+		// independent set of vertices with a low degree, the lowest first to remove more
+		std::vector<unsigned> candidates = level.vertices;
+		auto degree = [&]( const unsigned vertex ) { return level.offsets[vertex + 1u] - level.offsets[vertex]; };
+		std::stable_sort( candidates.begin(), candidates.end(), [&]( const unsigned a, const unsigned b ) { return degree( a ) < degree( b ); } );
+
+		std::vector<bool> removed( vertices.size(), false );
+		std::vector<bool> blocked( vertices.size(), false );
+		for ( unsigned vertex : candidates )
+		{
+			if ( blocked[vertex] || degree( vertex ) > max_degree )
+				continue;
+
+			removed[vertex] = true;
+			for ( unsigned i = level.offsets[vertex]; i < level.offsets[vertex + 1u]; i++ )
+				blocked[level.neighbors[i]] = true;
+		}
+
+		subset.clear();
+		for ( unsigned vertex : level.vertices )
+			if ( removed[vertex] == false )
+				subset.push_back( vertex );
+
+		// nothing removed, or the rest is flat
+		if ( subset.size() == level.vertices.size() || convex_hull( vertices, subset, epsilon, faces ) == false )
+			break;
+
+		m_levels.push_back( make_level( faces, static_cast<unsigned>( vertices.size() ) ) );
+	}
+
+	return true;
+}
+
+/**
+* @brief remove every level
+*/
+void DkHierarchy::clear()
+{
+	m_levels.clear();
+}
+
+/**
+* @brief	find the most extreme vertex in a given direction. The smallest hull is searched
+*			entirely, then its support vertex climbs to the support of every bigger hull, which
+*			is itself or a close vertex
+* @param vertices	vertices of the mesh the hierarchy was built from
+* @param dir		direction to find the vertex
+* @param steps		number of moves to a neighbor (optional)
+* @return index of the vertex
+*/
+unsigned DkHierarchy::support( const std::vector<vec3>& vertices, const vec3& dir, unsigned* steps ) const
+{
+	const DkLevel& top = m_levels.back();
+
+	unsigned best = top.vertices[0];
+	float max_distance = dot( vertices[best], dir );
+	for ( unsigned vertex : top.vertices )
+	{
+		const float distance = dot( vertices[vertex], dir );
+		if ( distance > max_distance )
+		{
+			max_distance = distance;
+			best = vertex;
+		}
+	}
+
+	unsigned moves = 0u;
+	for ( unsigned i = static_cast<unsigned>( m_levels.size() ) - 1u; i-- > 0u; )
+	{
+		const DkLevel& level = m_levels[i];
+
+		// hill climbing over the adjacency of the level
+		unsigned current;
+		do
+		{
+			current = best;
+			for ( unsigned j = level.offsets[current]; j < level.offsets[current + 1u]; j++ )
+			{
+				const float distance = dot( vertices[level.neighbors[j]], dir );
+				if ( distance > max_distance )
+				{
+					max_distance = distance;
+					best = level.neighbors[j];
+				}
+			}
+
+			if ( best != current )
+				moves++;
+		} while ( best != current );
+	}
+
+	if ( steps != nullptr )
+		*steps = moves;
+
+	return best;
+}
+
+/**
+* @brief check if the hierarchy was built
+* @return there are no levels
+*/
+bool DkHierarchy::empty() const
+{
+	return m_levels.empty();
+}
+
+/**
+* @brief get the levels, from the biggest hull
+* @return levels
+*/
+const std::vector<DkLevel>& DkHierarchy::levels() const
+{
+	return m_levels;
+}
@@ -0,0 +1,44 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: dk_hierarchy.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "math_utils.h"
+#include <vector>
+
+// convex hull of a subset of the vertices, each level keeps the ones of the next level
+struct DkLevel
+{
+	std::vector<unsigned> vertices;		// indices of the mesh vertices in the hull
+
+	// neighbors in the hull of every mesh vertex, empty for the vertices out of the level
+	std::vector<unsigned> offsets;
+	std::vector<unsigned> neighbors;
+};
+
+// Dobkin-Kirkpatrick hierarchy, the support vertex is found walking from the smallest hull to
+// the full one with a constant number of steps per level
+class DkHierarchy
+{
+public:
+	bool build( const std::vector<vec3>& vertices );
+	void clear();
+
+	unsigned support( const std::vector<vec3>& vertices, const vec3& dir, unsigned* steps = nullptr ) const;
+
+	bool					 empty	() const;
+	const std::vector<DkLevel>& levels() const;
+
+public:
+	static const unsigned top_vertex_count = 8u;	// the smallest hull is searched entirely
+	static const unsigned max_degree = 8u;			// only vertices with fewer neighbors are removed
+
+private:
+	std::vector<DkLevel> m_levels;		// the first one has every vertex of the hull
+};
@@ -0,0 +1,97 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: fixed_vector.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cassert>
+#include <new>
+#include <type_traits>
+
+// array with a size, stored inside the object so the small arrays built every step never allocate.
+// The elements are only constructed when added
+template <typename T, unsigned Capacity>
+class FixedVector
+{
+	static_assert( std::is_trivially_destructible<T>::value, "the elements are never destroyed" );
+
+public:
+	FixedVector() = default;
+
+	/**
+	* @brief copy only the used elements
+	* @param other
+	*/
+	FixedVector( const FixedVector& other )
+	{
+		*this = other;
+	}
+
+	/**
+	* @brief copy only the used elements
+	* @param other
+	* @return this
+	*/
+	FixedVector& operator=( const FixedVector& other )
+	{
+		if ( this == &other )
+			return *this;
+
+		m_size = other.m_size;
+		for ( unsigned i = 0u; i < m_size; i++ )
+			new ( data() + i ) T( other[i] );
+		return *this;
+	}
+
+	/**
+	* @brief add an element at the end, there must be room for it
+	* @param value
+	*/
+	void push_back( const T& value )
+	{
+		assert( m_size < Capacity );
+		new ( data() + m_size++ ) T( value );
+	}
+
+	/**
+	* @brief change the number of elements, the new ones are default constructed
+	* @param size	up to the capacity
+	*/
+	void resize( const unsigned size )
+	{
+		assert( size <= Capacity );
+		for ( unsigned i = m_size; i < size; i++ )
+			new ( data() + i ) T();
+		m_size = size;
+	}
+
+	void clear() { m_size = 0u; }
+
+	unsigned size		() const { return m_size; }
+	bool	 empty		() const { return m_size == 0u; }
+	bool	 full		() const { return m_size == Capacity; }
+	static constexpr unsigned capacity() { return Capacity; }
+
+	T&		 operator[]( const unsigned i )		  { assert( i < m_size ); return data()[i]; }
+	const T& operator[]( const unsigned i ) const { assert( i < m_size ); return data()[i]; }
+
+	T&		 back()		  { assert( m_size > 0u ); return data()[m_size - 1u]; }
+	const T& back() const { assert( m_size > 0u ); return data()[m_size - 1u]; }
+
+	T*		 data()			{ return std::launder( reinterpret_cast<T*>( m_storage ) ); }
+	const T* data() const	{ return std::launder( reinterpret_cast<const T*>( m_storage ) ); }
+
+	T*		 begin()		{ return data(); }
+	T*		 end()			{ return data() + m_size; }
+	const T* begin() const	{ return data(); }
+	const T* end()	 const	{ return data() + m_size; }
+
+private:
+	alignas( T ) unsigned char	m_storage[sizeof( T ) * Capacity];
+	unsigned					m_size{ 0u };
+};
@@ -0,0 +1,570 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: gjk.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "gjk.h"
+#include "collision.h"
+#include "profiler.h"
+
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+
+unsigned combine_features( const unsigned a, const unsigned b, const unsigned c );
+
+static const unsigned max_iterations = 64u;
+static const float epa_tolerance = 1e-4f;		// growth of the polytope considered converged
+static const float epa_visibility = 1e-5f;		// distance of a point over a face to see it, keeps coplanar faces
+static const float face_alignment = 0.95f;		// minimum cosine between a face and the normal to clip it
+
+
+// body in world space, the support points come from the hill climbing of its mesh
+struct SupportShape
+{
+	HalfEdgeMesh*	mesh;
+	Transform		trs;
+	mat3			to_local;	// transpose of the linear part, takes the directions to the mesh space
+};
+
+/**
+* @brief get the transformation of a body for the support queries
+* @param body
+* @param model	model to world transformation of the body
+* @return shape
+*/
+static SupportShape support_shape( const RigidBody& body, const Transform& model )
+{
+	return SupportShape{ body.mesh, model, transpose( model.linear ) };
+}
+
+/**
+* @brief point of the minkowski difference A - B farthest in a direction
+* @param shape_A
+* @param shape_B
+* @param dir		world direction
+* @return support point
+*/
+static SupportPoint support( const SupportShape& shape_A, const SupportShape& shape_B, const vec3& dir )
+{
+	SupportPoint point;
+	point.point_A = shape_A.trs.point( shape_A.mesh->hill_climbing( shape_A.to_local * dir ) );
+	point.point_B = shape_B.trs.point( shape_B.mesh->hill_climbing( shape_B.to_local * -dir ) );
+	point.point = point.point_A - point.point_B;
+	return point;
+}
+
+/**
+* @brief keep the given points of the simplex, newest first
+*/
+static void set_simplex( Simplex& simplex, const std::initializer_list<SupportPoint> points )
+{
+	simplex.count = 0u;
+	for ( const SupportPoint& point : points )
+		simplex.points[simplex.count++] = point;
+}
+
+/**
+* @brief	closest feature of a segment to the origin, the next direction is perpendicular to
+*			the segment towards the origin
+* @return the origin is in the simplex (never for a segment)
+*/
+static bool do_line( Simplex& simplex, vec3& dir )
+{
+	const SupportPoint a = simplex.points[0];
+	const SupportPoint b = simplex.points[1];
+
+	const vec3 ab = b.point - a.point;
+	const vec3 ao = -a.point;
+
+	if ( dot( ab, ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, b } );
+		dir = cross( cross( ab, ao ), ab );
+	}
+	else
+	{
+		set_simplex( simplex, { a } );
+		dir = ao;
+	}
+
+	return false;
+}
+
+/**
+* @brief closest feature of a triangle to the origin
+* @return the origin is in the simplex (never for a triangle)
+*/
+static bool do_triangle( Simplex& simplex, vec3& dir )
+{
+	const SupportPoint a = simplex.points[0];
+	const SupportPoint b = simplex.points[1];
+	const SupportPoint c = simplex.points[2];
+
+	const vec3 ab = b.point - a.point;
+	const vec3 ac = c.point - a.point;
+	const vec3 ao = -a.point;
+	const vec3 abc = cross( ab, ac );
+
+	if ( dot( cross( abc, ac ), ao ) > 0.0f )
+	{
+		if ( dot( ac, ao ) > 0.0f )
+		{
+			set_simplex( simplex, { a, c } );
+			dir = cross( cross( ac, ao ), ac );
+			return false;
+		}
+
+		set_simplex( simplex, { a, b } );
+		return do_line( simplex, dir );
+	}
+
+	if ( dot( cross( ab, abc ), ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, b } );
+		return do_line( simplex, dir );
+	}
+
+	// above or below the triangle, the winding keeps the origin over abc
+	if ( dot( abc, ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, b, c } );
+		dir = abc;
+	}
+	else
+	{
+		set_simplex( simplex, { a, c, b } );
+		dir = -abc;
+	}
+
+	return false;
+}
+
+/**
+* @brief	closest feature of a tetrahedron to the origin, the last triangle has the origin
+*			over it so only the three new faces are checked
+* @return the origin is in the simplex
+*/
+static bool do_tetrahedron( Simplex& simplex, vec3& dir )
+{
+	const SupportPoint a = simplex.points[0];
+	const SupportPoint b = simplex.points[1];
+	const SupportPoint c = simplex.points[2];
+	const SupportPoint d = simplex.points[3];
+
+	const vec3 ab = b.point - a.point;
+	const vec3 ac = c.point - a.point;
+	const vec3 ad = d.point - a.point;
+	const vec3 ao = -a.point;
+
+	if ( dot( cross( ab, ac ), ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, b, c } );
+		return do_triangle( simplex, dir );
+	}
+	if ( dot( cross( ac, ad ), ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, c, d } );
+		return do_triangle( simplex, dir );
+	}
+	if ( dot( cross( ad, ab ), ao ) > 0.0f )
+	{
+		set_simplex( simplex, { a, d, b } );
+		return do_triangle( simplex, dir );
+	}
+
+	return true;
+}
+
+/**
+* @brief	check if two bodies intersect with gjk, the support function is the hill climbing
+*			of the half edge meshes
+* @param body_A
+* @param body_B
+* @return simplex	simplex of the minkowski difference with the origin, for epa
+* @return the bodies intersect
+*/
+bool gjk_intersect( const RigidBody& body_A, const RigidBody& body_B, Simplex& simplex )
+{
+	return gjk_intersect( body_A, body_B, simplex, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief check if two bodies intersect with gjk
+* @param body_A
+* @param body_B
+* @param transform	transformations of the pair
+* @return simplex	simplex of the minkowski difference with the origin, for epa
+* @return the bodies intersect
+*/
+bool gjk_intersect( const RigidBody& body_A, const RigidBody& body_B, Simplex& simplex, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Gjk );
+
+	const SupportShape shape_A = support_shape( body_A, transform.model_A );
+	const SupportShape shape_B = support_shape( body_B, transform.model_B );
+
+	vec3 dir = body_A.position - body_B.position;
+	if ( glm::length2( dir ) < 1e-12f )
+		dir = vec3( 1.0f, 0.0f, 0.0f );
+
+	set_simplex( simplex, { support( shape_A, shape_B, dir ) } );
+	dir = -simplex.points[0].point;
+
+	for ( unsigned i = 0u; i < max_iterations; i++ )
+	{
+		// the origin is on the simplex, touching bodies
+		if ( glm::length2( dir ) < 1e-12f )
+			return true;
+
+		const SupportPoint point = support( shape_A, shape_B, dir );
+
+		// the farthest point does not pass the origin, dir separates the bodies
+		if ( dot( point.point, dir ) < 0.0f )
+			return false;
+
+		// newest first
+		for ( unsigned j = simplex.count; j > 0u; j-- )
+			simplex.points[j] = simplex.points[j - 1u];
+		simplex.points[0] = point;
+		simplex.count++;
+
+		bool contains_origin = false;
+		switch ( simplex.count )
+		{
+		case 2u: contains_origin = do_line( simplex, dir );			break;
+		case 3u: contains_origin = do_triangle( simplex, dir );		break;
+		case 4u: contains_origin = do_tetrahedron( simplex, dir );	break;
+		}
+
+		if ( contains_origin )
+			return true;
+	}
+
+	return false;
+}
+
+
+// triangle of the epa polytope, the normal points out of the polytope
+struct EpaFace
+{
+	unsigned a;
+	unsigned b;
+	unsigned c;
+
+	vec3	normal;
+	float	distance;	// from the origin to the plane of the face
+};
+
+/**
+* @brief create a face of the polytope, degenerate faces are never the closest one
+*/
+static EpaFace make_face( const std::vector<SupportPoint>& vertices, const unsigned a, const unsigned b, const unsigned c )
+{
+	EpaFace face{ a, b, c, vec3( 0.0f ), std::numeric_limits<float>::max() };
+
+	const vec3 normal = cross( vertices[b].point - vertices[a].point, vertices[c].point - vertices[a].point );
+	const float length = glm::length( normal );
+	if ( length > 1e-12f )
+	{
+		face.normal = normal / length;
+		face.distance = dot( face.normal, vertices[a].point );
+	}
+
+	return face;
+}
+
+/**
+* @brief	grow the simplex of gjk to a tetrahedron, it has less points when the origin lies
+*			on a vertex, an edge or a face of the minkowski difference
+* @return a tetrahedron could be built
+*/
+static bool complete_tetrahedron( const SupportShape& shape_A, const SupportShape& shape_B, std::vector<SupportPoint>& vertices )
+{
+	const vec3 axes[6] = { vec3( 1.0f, 0.0f, 0.0f ), vec3( -1.0f, 0.0f, 0.0f ),
+						   vec3( 0.0f, 1.0f, 0.0f ), vec3( 0.0f, -1.0f, 0.0f ),
+						   vec3( 0.0f, 0.0f, 1.0f ), vec3( 0.0f, 0.0f, -1.0f ) };
+	const float epsilon = 1e-8f;
+
+	// any other point
+	for ( unsigned i = 0u; i < 6u && vertices.size() == 1u; i++ )
+	{
+		const SupportPoint point = support( shape_A, shape_B, axes[i] );
+		if ( glm::length2( point.point - vertices[0].point ) > epsilon )
+			vertices.push_back( point );
+	}
+
+	// a point out of the line
+	for ( unsigned i = 0u; i < 6u && vertices.size() == 2u; i++ )
+	{
+		const vec3 line = vertices[1].point - vertices[0].point;
+		const SupportPoint point = support( shape_A, shape_B, cross( line, axes[i] ) );
+		if ( glm::length2( cross( point.point - vertices[0].point, line ) ) > epsilon )
+			vertices.push_back( point );
+	}
+
+	// a point out of the plane
+	for ( unsigned i = 0u; i < 2u && vertices.size() == 3u; i++ )
+	{
+		const vec3 normal = cross( vertices[1].point - vertices[0].point, vertices[2].point - vertices[0].point );
+		const SupportPoint point = support( shape_A, shape_B, i == 0u ? normal : -normal );
+		if ( std::abs( dot( point.point - vertices[0].point, normal ) ) > epsilon )
+			vertices.push_back( point );
+	}
+
+	return vertices.size() == 4u;
+}
+
+/**
+* @brief	expand the simplex of gjk inside the minkowski difference until the face closest
+*			to the origin is on its surface, the face gives the penetration of the bodies
+* @param body_A
+* @param body_B
+* @param simplex		simplex of gjk with the origin
+* @return penetration	normal, depth and deepest points of both bodies
+* @return the penetration could be found
+*/
+bool epa_penetration( const RigidBody& body_A, const RigidBody& body_B, const Simplex& simplex, Penetration& penetration )
+{
+	return epa_penetration( body_A, body_B, simplex, penetration, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief expand the simplex of gjk to the face of the minkowski difference closest to the origin
+* @param body_A
+* @param body_B
+* @param simplex		simplex of gjk with the origin
+* @param transform		transformations of the pair
+* @return penetration	normal, depth and deepest points of both bodies
+* @return the penetration could be found
+*/
+bool epa_penetration( const RigidBody& body_A, const RigidBody& body_B, const Simplex& simplex, Penetration& penetration, const PairTransform& transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Epa );
+
+	const SupportShape shape_A = support_shape( body_A, transform.model_A );
+	const SupportShape shape_B = support_shape( body_B, transform.model_B );
+
+	// reused by every query of the thread
+	static thread_local std::vector<SupportPoint> vertices;
+	static thread_local std::vector<EpaFace> faces;
+	static thread_local std::vector<std::pair<unsigned, unsigned>> horizon;
+
+	vertices.assign( simplex.points, simplex.points + simplex.count );
+	if ( complete_tetrahedron( shape_A, shape_B, vertices ) == false )
+		return false;
+
+	// faces of the tetrahedron pointing away from the other vertex
+	faces.clear();
+	const unsigned tetrahedron[4][4] = { { 0u, 1u, 2u, 3u }, { 0u, 3u, 1u, 2u }, { 0u, 2u, 3u, 1u }, { 1u, 3u, 2u, 0u } };
+	for ( const auto& indices : tetrahedron )
+	{
+		EpaFace face = make_face( vertices, indices[0], indices[1], indices[2] );
+		if ( dot( face.normal, vertices[indices[3]].point - vertices[indices[0]].point ) > 0.0f )
+			face = make_face( vertices, indices[0], indices[2], indices[1] );
+		faces.push_back( face );
+	}
+
+	auto closest_face = [&]()
+	{
+		unsigned closest = 0u;
+		for ( unsigned i = 1u; i < faces.size(); i++ )
+			if ( faces[i].distance < faces[closest].distance )
+				closest = i;
+		return closest;
+	};
+
+	for ( unsigned i = 0u; i < max_iterations; i++ )
+	{
+		const EpaFace face = faces[closest_face()];
+		if ( face.distance == std::numeric_limits<float>::max() )
+			return false;
+
+		// the polytope does not grow towards the closest face anymore
+		const SupportPoint point = support( shape_A, shape_B, face.normal );
+		if ( dot( point.point, face.normal ) - face.distance < epa_tolerance )
+			break;
+
+		const unsigned index = static_cast<unsigned>( vertices.size() );
+		vertices.push_back( point );
+
+		// remove the faces that see the new point, their open edges are the horizon
+		horizon.clear();
+		auto add_edge = [&]( const unsigned a, const unsigned b )
+		{
+			for ( auto it = horizon.begin(); it != horizon.end(); it++ )
+			{
+				// shared by two removed faces
+				if ( it->first == b && it->second == a )
+				{
+					horizon.erase( it );
+					return;
+				}
+			}
+			horizon.push_back( { a, b } );
+		};
+
+		for ( unsigned j = 0u; j < faces.size(); )
+		{
+			const EpaFace& visible = faces[j];
+			if ( dot( visible.normal, point.point - vertices[visible.a].point ) > epa_visibility )
+			{
+				add_edge( visible.a, visible.b );
+				add_edge( visible.b, visible.c );
+				add_edge( visible.c, visible.a );
+
+				faces[j] = faces.back();
+				faces.pop_back();
+				continue;
+			}
+			j++;
+		}
+
+		// the horizon keeps the winding of the removed faces
+		for ( const auto& edge : horizon )
+			faces.push_back( make_face( vertices, edge.first, edge.second, index ) );
+
+		if ( faces.empty() )
+			return false;
+	}
+
+	const EpaFace& face = faces[closest_face()];
+	if ( face.distance == std::numeric_limits<float>::max() )
+		return false;
+
+	// barycentric coordinates of the projection of the origin
+	const vec3 a = vertices[face.a].point;
+	const vec3 b = vertices[face.b].point;
+	const vec3 c = vertices[face.c].point;
+	const vec3 p = face.normal * face.distance;
+
+	const vec3 v0 = b - a;
+	const vec3 v1 = c - a;
+	const vec3 v2 = p - a;
+	const float d00 = dot( v0, v0 );
+	const float d01 = dot( v0, v1 );
+	const float d11 = dot( v1, v1 );
+	const float d20 = dot( v2, v0 );
+	const float d21 = dot( v2, v1 );
+	const float denominator = d00 * d11 - d01 * d01;
+
+	const float v = denominator != 0.0f ? ( d11 * d20 - d01 * d21 ) / denominator : 0.0f;
+	const float w = denominator != 0.0f ? ( d00 * d21 - d01 * d20 ) / denominator : 0.0f;
+	const float u = 1.0f - v - w;
+
+	penetration.normal = face.normal;
+	penetration.depth = glm::max( face.distance, 0.0f );
+	penetration.point_A = vertices[face.a].point_A * u + vertices[face.b].point_A * v + vertices[face.c].point_A * w;
+	penetration.point_B = vertices[face.a].point_B * u + vertices[face.b].point_B * v + vertices[face.c].point_B * w;
+
+	return true;
+}
+
+/**
+* @brief	build the contact manifold of a penetration. When a face of one of the bodies is
+*			aligned with the normal its incident face is clipped as with sat, otherwise the
+*			deepest points are the only contact
+* @param body_A
+* @param body_B
+* @param penetration
+* @return contact manifold
+*/
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const Penetration& penetration )
+{
+	return get_contact_manifold( body_A, body_B, penetration, make_pair_transform( body_A, body_B ) );
+}
+
+/**
+* @brief build the contact manifold of a penetration
+* @param body_A
+* @param body_B
+* @param penetration
+* @param transform	transformations of the pair
+* @return contact manifold
+*/
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const Penetration& penetration, const PairTransform& transform )
+{
+	// faces of both bodies closest to the normal
+	auto aligned_face = []( const RigidBody& body, const Transform& model, const vec3& normal, float& alignment )
+	{
+		const mat3& linear = model.linear;
+		const std::vector<FlatFace>& faces = body.mesh->flat_faces();
+
+		unsigned best = 0u;
+		alignment = -1.0f;
+		for ( unsigned i = 0u; i < faces.size(); i++ )
+		{
+			const float cosine = dot( normalize( linear * faces[i].normal ), normal );
+			if ( cosine > alignment )
+			{
+				alignment = cosine;
+				best = i;
+			}
+		}
+		return best;
+	};
+
+	float alignment_A;
+	float alignment_B;
+	const unsigned face_A = aligned_face( body_A, transform.model_A, penetration.normal, alignment_A );
+	const unsigned face_B = aligned_face( body_B, transform.model_B, -penetration.normal, alignment_B );
+
+	ContactManifold contact;
+
+	if ( glm::max( alignment_A, alignment_B ) >= face_alignment )
+	{
+		if ( alignment_A >= alignment_B )
+		{
+			ContactFace reference{ face_A, -penetration.depth };
+			contact = get_contact_manifold( body_A, body_B, reference, transform );
+		}
+		else
+		{
+			ContactFace reference{ face_B, -penetration.depth };
+			contact = get_contact_manifold( body_B, body_A, reference, swap_pair_transform( transform ) );
+		}
+
+		if ( contact.points.empty() == false )
+			return contact;
+	}
+
+	// the deepest points, identified by the closest faces
+	contact.normal = penetration.normal;
+	contact.feature = combine_features( face_A, face_B, 2u );
+	contact.points.clear();
+	contact.points.push_back( { penetration.point_A, penetration.point_B, penetration.depth, 0.0f, 0.0f, contact.feature } );
+	contact.body_A = &body_A;
+	contact.body_B = &body_B;
+
+	return contact;
+}
+
+/**
+* @brief check if to bodies collide with gjk and epa
+* @param body_A
+* @param body_B
+* @param transform		transformations of the pair from the cache of the step (optional, otherwise
+*						built from the bodies)
+* @return contact_data	contact manifold of the collision
+* @return the bodies are colliding
+*/
+bool overlap_gjk( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const PairTransform* transform )
+{
+	const PairTransform pair = transform != nullptr ? *transform : make_pair_transform( body_A, body_B );
+
+	Simplex simplex;
+	if ( gjk_intersect( body_A, body_B, simplex, pair ) == false )
+		return false;
+
+	Penetration penetration;
+	if ( epa_penetration( body_A, body_B, simplex, penetration, pair ) == false )
+		return false;
+
+	contact_data = get_contact_manifold( body_A, body_B, penetration, pair );
+	return true;
+}
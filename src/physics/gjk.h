@@ -0,0 +1,50 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: gjk.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+#include "transform.h"
+
+#include "math_utils.h"
+
+// point of the minkowski difference A - B and the points of the bodies that created it
+struct SupportPoint
+{
+	vec3 point;
+	vec3 point_A;
+	vec3 point_B;
+};
+
+// up to a tetrahedron of the minkowski difference, the newest point first
+struct Simplex
+{
+	SupportPoint points[4];
+	unsigned	 count{ 0u };
+};
+
+// penetration found by epa
+struct Penetration
+{
+	vec3	normal;		// from A to B
+	float	depth;
+	vec3	point_A;	// deepest points of the bodies
+	vec3	point_B;
+};
+
+bool overlap_gjk( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const PairTransform* transform = nullptr );
+
+bool gjk_intersect	( const RigidBody& body_A, const RigidBody& body_B, Simplex& simplex );
+bool gjk_intersect	( const RigidBody& body_A, const RigidBody& body_B, Simplex& simplex, const PairTransform& transform );
+bool epa_penetration( const RigidBody& body_A, const RigidBody& body_B, const Simplex& simplex, Penetration& penetration );
+bool epa_penetration( const RigidBody& body_A, const RigidBody& body_B, const Simplex& simplex, Penetration& penetration, const PairTransform& transform );
+
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const Penetration& penetration );
+ContactManifold get_contact_manifold( RigidBody& body_A, RigidBody& body_B, const Penetration& penetration, const PairTransform& transform );
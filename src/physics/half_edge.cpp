@@ -9,6 +9,12 @@ Creation date: 01/20/2020
 ----------------------------------------------------------------------------------------------------------*/
 #include "half_edge.h"
 
+#include <cassert>
+#include <unordered_map>
+
+
+unsigned HalfEdgeMesh::hierarchy_vertex_count = 512u;
+unsigned HalfEdgeMesh::wide_vertex_count = 512u;
 
 /*		HALF EDGE FACE		*/
 
@@ -80,6 +86,13 @@ void HalfEdgeMesh::clear()
 	}
 
 	m_faces.clear();
+	m_unique_edges.clear();
+	m_flat_edges.clear();
+	m_flat_faces.clear();
+	m_face_vertices.clear();
+	m_vertex_edges.clear();
+	m_hierarchy.clear();
+	m_wide_vertices.clear();
 }
 
 
@@ -96,6 +109,42 @@ const std::vector<HalfEdgeFace*>& HalfEdgeMesh::faces() const
 	return m_faces;
 }
 
+/**
+* @brief get the edges shared by two faces, one half edge of every twin pair
+* @return edges
+*/
+const std::vector<UniqueEdge>& HalfEdgeMesh::unique_edges() const
+{
+	return m_unique_edges;
+}
+
+/**
+* @brief get the edges of the flat storage, the edges of every face in order
+* @return edges
+*/
+const std::vector<FlatEdge>& HalfEdgeMesh::flat_edges() const
+{
+	return m_flat_edges;
+}
+
+/**
+* @brief get the faces of the flat storage, in the order of faces()
+* @return faces
+*/
+const std::vector<FlatFace>& HalfEdgeMesh::flat_faces() const
+{
+	return m_flat_faces;
+}
+
+/**
+* @brief get the vertex indices of every face of the flat storage
+* @return indices, a range of them for every face
+*/
+const std::vector<unsigned>& HalfEdgeMesh::face_vertices() const
+{
+	return m_face_vertices;
+}
+
 /**
 * @brief get vertices
 * @return vertices
@@ -123,6 +172,24 @@ const std::vector<unsigned>& HalfEdgeMesh::render_indices() const
 	return m_render_indices;
 }
 
+/**
+* @brief get minimum corner of the local bounding box
+* @return minimum corner
+*/
+const vec3& HalfEdgeMesh::bounds_min() const
+{
+	return m_bounds_min;
+}
+
+/**
+* @brief get maximum corner of the local bounding box
+* @return maximum corner
+*/
+const vec3& HalfEdgeMesh::bounds_max() const
+{
+	return m_bounds_max;
+}
+
 /**
 * @brief get index to the renderable mesh
 * @return index
@@ -153,6 +220,13 @@ void HalfEdgeMesh::add_vertices( const std::vector<vec3>& vertices )
 {
 	// add the vertices to the end of the vertices vector
 	std::copy( vertices.begin(), vertices.end(), std::back_inserter( m_vertices ) );
+
+	// grow the local bounding box
+	for ( const vec3& vertex : vertices )
+	{
+		m_bounds_min = glm::min( m_bounds_min, vertex );
+		m_bounds_max = glm::max( m_bounds_max, vertex );
+	}
 }
 
 /**
@@ -252,6 +326,8 @@ void HalfEdgeMesh::link_twins()
 			} while ( edge_1 != ( *face_1 )->m_edge );
 		}
 	}
+
+	set_flat_storage();
 }
 
 /**
@@ -346,6 +422,8 @@ void HalfEdgeMesh::merge_faces()
 
 		face_it++;
 	}
+
+	set_flat_storage();
 }
 
 /**
@@ -374,6 +452,152 @@ void HalfEdgeMesh::set_indices()
 			edge = edge->next;
 		} while ( edge != face->m_edge );
 	}
+
+	set_unique_edges();
+	set_vertex_edges();
+	set_wide_vertices();
+}
+
+/**
+* @brief	store the vertices in blocks of simd_width with an array per coordinate for the wide
+*			search, and choose the support method by the number of vertices
+*/
+void HalfEdgeMesh::set_wide_vertices()
+{
+	const unsigned count = static_cast<unsigned>( m_vertices.size() );
+	m_wide_vertices.resize( ( count + simd_width - 1u ) / simd_width );
+
+	for ( unsigned block = 0u; block < m_wide_vertices.size(); block++ )
+	{
+		alignas( 32 ) float x[simd_width];
+		alignas( 32 ) float y[simd_width];
+		alignas( 32 ) float z[simd_width];
+
+		// the padding repeats the first vertex, which never beats it
+		for ( unsigned lane = 0u; lane < simd_width; lane++ )
+		{
+			const unsigned index = block * simd_width + lane;
+			const vec3& vertex = m_vertices[index < count ? index : 0u];
+			x[lane] = vertex.x;
+			y[lane] = vertex.y;
+			z[lane] = vertex.z;
+		}
+
+		m_wide_vertices[block] = WideVec3{ wide_load( x ), wide_load( y ), wide_load( z ) };
+	}
+
+	m_support_method = count <= wide_vertex_count ? SupportMethod::Wide : SupportMethod::HillClimbing;
+}
+
+/**
+* @brief	build the Dobkin-Kirkpatrick hierarchy of the convex hull of the vertices, used by the
+*			support queries without a hint. Flat meshes have none
+*/
+void HalfEdgeMesh::build_hierarchy()
+{
+	m_hierarchy.build( m_vertices );
+}
+
+/**
+* @brief get the Dobkin-Kirkpatrick hierarchy
+* @return hierarchy, empty if it was not built
+*/
+const DkHierarchy& HalfEdgeMesh::hierarchy() const
+{
+	return m_hierarchy;
+}
+
+/**
+* @brief	copy the linked faces to contiguous arrays of edges, faces and face vertices linked
+*			by indices, which the queries walk instead of the pointers scattered in the heap.
+*			Rebuilt every time the links of the faces change
+*/
+void HalfEdgeMesh::set_flat_storage()
+{
+	m_flat_edges.clear();
+	m_flat_faces.clear();
+	m_face_vertices.clear();
+
+	// the edges of every face are consecutive, starting from the edge of the face
+	std::unordered_map<const HalfEdge*, unsigned> indices;
+	for ( auto& face : m_faces )
+	{
+		auto edge = face->m_edge;
+		do
+		{
+			indices[edge] = static_cast<unsigned>( indices.size() );
+			edge = edge->next;
+		} while ( edge != face->m_edge );
+	}
+
+	m_flat_edges.reserve( indices.size() );
+	m_face_vertices.reserve( indices.size() );
+
+	for ( unsigned i = 0u; i < m_faces.size(); i++ )
+	{
+		const HalfEdgeFace* face = m_faces[i];
+
+		FlatFace flat_face;
+		flat_face.normal = face->m_normal;
+		flat_face.edge = static_cast<unsigned>( m_flat_edges.size() );
+		flat_face.first_vertex = static_cast<unsigned>( m_face_vertices.size() );
+
+		auto edge = face->m_edge;
+		do
+		{
+			const unsigned twin = edge->twin != nullptr ? indices[edge->twin] : no_edge;
+			m_flat_edges.push_back( FlatEdge{ edge->vertex, twin, indices[edge->next], indices[edge->prev], i } );
+			m_face_vertices.push_back( edge->vertex );
+
+			edge = edge->next;
+		} while ( edge != face->m_edge );
+
+		flat_face.vertex_count = static_cast<unsigned>( m_face_vertices.size() ) - flat_face.first_vertex;
+		assert( flat_face.vertex_count <= max_face_vertices );
+		m_flat_faces.push_back( flat_face );
+	}
+}
+
+/**
+* @brief	keep an edge pointing to every vertex, where the hill climbing can start from any
+*			vertex. The vertex of the first face keeps the edge of the face, the start of
+*			hill_climbing
+*/
+void HalfEdgeMesh::set_vertex_edges()
+{
+	m_vertex_edges.assign( m_vertices.size(), no_edge );
+
+	for ( unsigned i = 0u; i < m_flat_edges.size(); i++ )
+		if ( m_vertex_edges[m_flat_edges[i].vertex] == no_edge )
+			m_vertex_edges[m_flat_edges[i].vertex] = i;
+}
+
+/**
+* @brief	store every edge once with the normals of both of its faces, so the SAT edge
+*			query does not visit the twins nor follow the pointers of the faces
+*/
+void HalfEdgeMesh::set_unique_edges()
+{
+	m_unique_edges.clear();
+
+	// O(n)
+	for ( unsigned i = 0u; i < m_flat_edges.size(); i++ )
+	{
+		const FlatEdge& edge = m_flat_edges[i];
+
+		// open edges have no second face, a twin before this edge was already added
+		if ( edge.twin == no_edge || edge.twin < i )
+			continue;
+
+		UniqueEdge unique;
+		unique.tail = m_vertices[m_flat_edges[edge.prev].vertex];
+		unique.head = m_vertices[edge.vertex];
+		unique.direction = normalize( unique.head - unique.tail );
+		unique.normal_A = m_flat_faces[edge.face].normal;
+		unique.normal_B = m_flat_faces[m_flat_edges[edge.twin].face].normal;
+		unique.edge = i;
+		m_unique_edges.push_back( unique );
+	}
 }
 
 /**
@@ -481,48 +705,184 @@ mat3 HalfEdgeMesh::compute_intertia_tensor() const
 * @brief	find the most extreme vertex in a given direction.
 *			compute the distance in the direction of an arbitrary vertex in the mesh
 			and compare it with the rest of the neightbors until all of them are at 
-			a shorter distance
+			a shorter distance. Goes through the support method of the mesh
 * @param dir	direction to find the vertex
 * @return vertex position
 */
-vec3 HalfEdgeMesh::hill_climbing( const vec3 dir )
+vec3 HalfEdgeMesh::hill_climbing( const vec3 dir ) const
+{
+	return m_vertices[support( dir )];
+}
+
+/**
+* @brief	find the most extreme vertex in a given direction checking every vertex, simd_width at
+*			a time without branches. Same vertex as hill_climbing_bruteforce
+* @param dir	direction to find the vertex
+* @return index of the vertex
+*/
+unsigned HalfEdgeMesh::wide_support( const vec3& dir ) const
 {
-	// get arbitrary edge
-	auto edge = m_faces[0]->m_edge;
-	auto next_edge = edge;
+	const WideVec3 wide_dir{ wide_set( dir.x ), wide_set( dir.y ), wide_set( dir.z ) };
+
+	// best distance and vertex of every lane, the first one on ties
+	WideFloat best = wide_set( -std::numeric_limits<float>::max() );
+	WideFloat best_index = wide_set( 0.0f );
+
+	alignas( 32 ) float lanes[simd_width];
+	for ( unsigned lane = 0u; lane < simd_width; lane++ )
+		lanes[lane] = static_cast<float>( lane );
+	WideFloat index = wide_load( lanes );
+	const WideFloat step = wide_set( static_cast<float>( simd_width ) );
+
+	for ( const WideVec3& block : m_wide_vertices )
+	{
+		const WideFloat distance = wide_dot( block, wide_dir );
+		const WideFloat greater = wide_greater( distance, best );
+
+		best = wide_select( greater, distance, best );
+		best_index = wide_select( greater, index, best_index );
+		index = index + step;
+	}
+
+	// the best lane, the lowest vertex on ties
+	alignas( 32 ) float distances[simd_width];
+	alignas( 32 ) float indices[simd_width];
+	wide_store( distances, best );
+	wide_store( indices, best_index );
+
+	unsigned result = 0u;
+	float max_distance = -std::numeric_limits<float>::max();
+	for ( unsigned lane = 0u; lane < simd_width; lane++ )
+	{
+		const unsigned vertex = static_cast<unsigned>( indices[lane] );
+		if ( distances[lane] > max_distance || ( distances[lane] == max_distance && vertex < result ) )
+		{
+			max_distance = distances[lane];
+			result = vertex;
+		}
+	}
+
+	return result;
+}
+
+/**
+* @brief	find the most extreme vertex in a given direction. From a hint the hill climbing takes
+*			few steps, without one the method of the mesh searches every vertex of small meshes
+*			or walks down the hierarchy of the big ones
+* @param dir		direction to find the vertex
+* @param start		index of the first vertex of the hill climbing, none by default
+* @param steps		number of moves to a neighbor, 0 for the wide search (optional)
+* @return index of the vertex
+*/
+unsigned HalfEdgeMesh::support( const vec3& dir, const unsigned start, unsigned* steps ) const
+{
+	if ( start < m_vertices.size() )
+		return support_vertex( dir, start, steps );
+
+	if ( m_support_method == SupportMethod::Wide )
+	{
+		if ( steps != nullptr )
+			*steps = 0u;
+		return wide_support( dir );
+	}
+
+	if ( m_hierarchy.empty() == false )
+		return m_hierarchy.support( m_vertices, dir, steps );
+
+	return support_vertex( dir, start, steps );
+}
+
+/**
+* @brief change how the mesh finds its support vertices
+* @param method
+*/
+void HalfEdgeMesh::set_support_method( const SupportMethod method )
+{
+	m_support_method = method;
+}
+
+/**
+* @brief get how the mesh finds its support vertices
+* @return method
+*/
+SupportMethod HalfEdgeMesh::support_method() const
+{
+	return m_support_method;
+}
+
+/**
+* @brief	find the most extreme vertex in a given direction walking down the Dobkin-Kirkpatrick
+*			hierarchy, logarithmic in the number of vertices
+* @param dir		direction to find the vertex
+* @param steps		number of moves to a neighbor (optional)
+* @return index of the vertex, hill climbing from the first face without a hierarchy
+*/
+unsigned HalfEdgeMesh::hierarchy_support( const vec3& dir, unsigned* steps ) const
+{
+	if ( m_hierarchy.empty() )
+		return support_vertex( dir, m_flat_edges[m_flat_faces[0].edge].vertex, steps );
+
+	return m_hierarchy.support( m_vertices, dir, steps );
+}
+
+/**
+* @brief	find the most extreme vertex in a given direction, climbing from a hint such as the
+*			support vertex of the last query. It does not modify the mesh, any number of threads
+*			can query it at the same time
+* @param dir		direction to find the vertex
+* @param start		index of the first vertex, any vertex without faces starts from the first face
+* @param steps		number of moves to a neighbor (optional)
+* @return index of the vertex
+*/
+unsigned HalfEdgeMesh::support_vertex( const vec3& dir, const unsigned start, unsigned* steps ) const
+{
+	// get the edge of the hint
+	unsigned edge = start < m_vertex_edges.size() ? m_vertex_edges[start] : no_edge;
+	if ( edge == no_edge )
+		edge = m_flat_faces[0].edge;
+	unsigned next_edge = edge;
+
+	unsigned moves = 0u;
 
 	// O(m^2)
 	do
 	{
+		if ( edge != next_edge )
+			moves++;
+
 		edge = next_edge;
-		float max_distance = dot( m_vertices[edge->vertex], dir );
-		auto it_edge = edge;
+		float max_distance = dot( m_vertices[m_flat_edges[edge].vertex], dir );
+		unsigned it_edge = edge;
 
 		do
 		{
 			// no twin
-			if ( it_edge->twin == nullptr )
+			const unsigned twin = m_flat_edges[it_edge].twin;
+			if ( twin == no_edge )
 				break;
 
 			// distance of current adjacent vertex
-			float dist = dot( m_vertices[it_edge->twin->vertex], dir );
+			float dist = dot( m_vertices[m_flat_edges[twin].vertex], dir );
 
 			// new highest distance
 			if ( dist > max_distance )
 			{
-				next_edge = it_edge->twin;
+				next_edge = twin;
 				max_distance = dist;
 			}
 
 			// loop around the edges pointing towards the same vertex
-			it_edge = it_edge->twin->prev;
+			it_edge = m_flat_edges[twin].prev;
 
 		} while ( it_edge != edge );
 
 		// the edge is the same as in the previous iteration
-	} while (edge != next_edge);
+	} while ( edge != next_edge );
+
+	if ( steps != nullptr )
+		*steps = moves;
 
-	return m_vertices[edge->vertex];
+	return m_flat_edges[edge].vertex;
 }
 
 /**
@@ -530,7 +890,7 @@ vec3 HalfEdgeMesh::hill_climbing( const vec3 dir )
 * @param dir	direction to find the vertex
 * @return vertex position
 */
-vec3 HalfEdgeMesh::hill_climbing_bruteforce( const vec3 dir )
+vec3 HalfEdgeMesh::hill_climbing_bruteforce( const vec3 dir ) const
 {
 	float max_distance = dot( m_vertices[0u], dir );
 	unsigned max_index = 0u;
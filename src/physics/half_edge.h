@@ -10,6 +10,9 @@ Creation date: 01/20/2020
 #pragma once
 
 #include "math_utils.h"
+#include "dk_hierarchy.h"
+#include "simd.h"
+#include <limits>
 #include <vector>
 
 struct HalfEdge;
@@ -40,6 +43,53 @@ struct HalfEdgeFace
 };
 
 
+// index of a missing edge of the flat storage, like the twin of an open edge
+const unsigned no_edge = std::numeric_limits<unsigned>::max();
+
+// vertices of the largest merged face of a mesh, the caps of the cylinder have 12
+const unsigned max_face_vertices = 12u;
+
+// half edge of the flat storage, every link is an index to the arrays of the mesh
+struct FlatEdge
+{
+	unsigned vertex;
+	unsigned twin;		// no_edge for open edges
+	unsigned next;
+	unsigned prev;
+	unsigned face;
+};
+
+// face of the flat storage, its vertices are a range of the face vertices of the mesh
+struct FlatFace
+{
+	vec3		normal;
+	unsigned	edge;			// first edge, the one of m_edge
+	unsigned	first_vertex;
+	unsigned	vertex_count;
+};
+
+
+// edge shared by two faces with the data of the SAT edge query, stored once for both twins
+struct UniqueEdge
+{
+	vec3 tail;
+	vec3 head;
+	vec3 direction;		// normalized, from tail to head
+	vec3 normal_A;		// normal of the face of the half edge
+	vec3 normal_B;		// normal of the face of the twin
+
+	unsigned edge;		// flat index of the half edge, goes from tail to head
+};
+
+
+// how a mesh finds its support vertices without a hint
+enum class SupportMethod
+{
+	HillClimbing,	// down the hierarchy, or from the first face
+	Wide			// every vertex, simd_width at a time
+};
+
+
 class HalfEdgeMesh
 {
 public:
@@ -51,6 +101,12 @@ public:
 	const std::vector<unsigned>&		indices			() const;
 	const std::vector<unsigned>&		render_indices		() const;
 	const std::vector<HalfEdgeFace*>&	faces			() const;
+	const std::vector<UniqueEdge>&		unique_edges	() const;
+	const std::vector<FlatEdge>&		flat_edges		() const;
+	const std::vector<FlatFace>&		flat_faces		() const;
+	const std::vector<unsigned>&		face_vertices	() const;
+	const vec3&				bounds_min		() const;
+	const vec3&				bounds_max		() const;
 
 
 	void add_vertices	( const std::vector<vec3>& vertices );
@@ -63,19 +119,61 @@ public:
 	void link_twins();
 	void merge_faces();
 	void set_indices();
+	void build_hierarchy();
 	mat3 compute_intertia_tensor() const;
 
+	const DkHierarchy& hierarchy() const;
+
 public:
-	vec3 hill_climbing( const vec3 dir );
-	vec3 hill_climbing_bruteforce( const vec3 dir );
+	vec3	 hill_climbing( const vec3 dir ) const;
+	vec3	 hill_climbing_bruteforce( const vec3 dir ) const;
+	unsigned support_vertex( const vec3& dir, const unsigned start, unsigned* steps = nullptr ) const;
+	unsigned hierarchy_support( const vec3& dir, unsigned* steps = nullptr ) const;
+	unsigned wide_support( const vec3& dir ) const;
+	unsigned support( const vec3& dir, const unsigned start = std::numeric_limits<unsigned>::max(), unsigned* steps = nullptr ) const;
+
+	void		  set_support_method( const SupportMethod method );
+	SupportMethod support_method() const;
+
+	// meshes with up to this many vertices use the wide search without a hint. It beats the
+	// hill climbing of every mesh in the half_edge.wide_support benchmark and the hierarchy up
+	// to the gourd (326), not the bunny (2503). With a hint the hill climbing is faster
+	static unsigned wide_vertex_count;
 
+	// meshes with at least this many vertices build their hierarchy when they are loaded. In
+	// the half_edge.dk_hierarchy benchmark hill climbing is faster on the sphere (122) and the
+	// hierarchy on the gourd (326), but below wide_vertex_count the wide search is faster
+	static unsigned hierarchy_vertex_count;
 
 
+
+private:
+	void set_flat_storage();
+	void set_unique_edges();
+	void set_vertex_edges();
+	void set_wide_vertices();
+
 private:
 	std::vector<vec3>		m_vertices;
 	std::vector<unsigned>		m_render_indices;
 	std::vector<unsigned>		m_indices;
 	std::vector<HalfEdgeFace*>	m_faces;
+	std::vector<UniqueEdge>		m_unique_edges;
+
+	// the faces and edges in contiguous arrays, built from the linked faces once they are final
+	std::vector<FlatEdge>		m_flat_edges;		// the edges of every face in order
+	std::vector<FlatFace>		m_flat_faces;		// same order as m_faces
+	std::vector<unsigned>		m_face_vertices;	// vertex indices of every face in order
+	std::vector<unsigned>		m_vertex_edges;		// flat edge pointing to every vertex, no_edge if no face uses it
+	DkHierarchy				m_hierarchy;		// optional, for the support queries without a hint
+
+	// the vertices simd_width at a time, the last block repeats the first vertex
+	std::vector<WideVec3>	m_wide_vertices;
+	SupportMethod			m_support_method{ SupportMethod::HillClimbing };
+
+	// local space bounding box of the vertices
+	vec3 m_bounds_min{ std::numeric_limits<float>::max() };
+	vec3 m_bounds_max{ -std::numeric_limits<float>::max() };
 
 	unsigned m_render_mesh;
 };
@@ -17,16 +17,17 @@ Creation date: 01/27/2020
 */
 Contact intersection_ray_polyhedra( const Ray ray, const HalfEdgeMesh* polyhedra )
 {
-	auto faces = polyhedra->faces();
-	auto& vertices = polyhedra->vertices();
+	const std::vector<FlatFace>& faces = polyhedra->flat_faces();
+	const std::vector<unsigned>& face_vertices = polyhedra->face_vertices();
+	const std::vector<vec3>& vertices = polyhedra->vertices();
 
 	Contact contact;
 	contact.time = -1.0f;
 
 	// check raycast for each face
-	for ( HalfEdgeFace* face : faces )
+	for ( const FlatFace& face : faces )
 	{
-		Contact temp = intersection_ray_polygon( ray, vertices, face->m_vertices );
+		Contact temp = intersection_ray_polygon( ray, vertices, face_vertices.data() + face.first_vertex, face.vertex_count );
 
 		if ( temp.time != -1.0f && ( temp.time < contact.time || contact.time == -1.0f ) )
 			contact = temp;
@@ -38,16 +39,18 @@ Contact intersection_ray_polyhedra( const Ray ray, const HalfEdgeMesh* polyhedra
 /**
 * @brief compute the collision between a ray and a polygon
 * @param ray
-* @param polygon
+* @param vertices
+* @param indices	vertices of the polygon
+* @param count		number of indices
 * @return contact information
 */
-Contact intersection_ray_polygon( const Ray ray, const std::vector<vec3>& vertices, const std::vector<unsigned>& indices )
+Contact intersection_ray_polygon( const Ray ray, const std::vector<vec3>& vertices, const unsigned* indices, const unsigned count )
 {
 	Contact contact;
 	contact.time = -1.0f;
 
 	// check raycast for each triangle
-	for ( unsigned i = 1u; i < indices.size() - 1; i++ )
+	for ( unsigned i = 1u; i + 1u < count; i++ )
 	{
 		Contact temp = intersection_ray_triangle( ray, vertices[indices[0u]], vertices[indices[i]], vertices[indices[i + 1u]] );
 
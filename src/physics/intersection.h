@@ -28,6 +28,6 @@ struct Ray
 };
 
 Contact intersection_ray_polyhedra	( const Ray ray, const HalfEdgeMesh* polyhedra );
-Contact	intersection_ray_polygon	( const Ray ray, const std::vector<vec3>& vertices, const std::vector<unsigned>& indices );
+Contact	intersection_ray_polygon	( const Ray ray, const std::vector<vec3>& vertices, const unsigned* indices, const unsigned count );
 Contact intersection_ray_triangle	( const Ray ray, const vec3 p, const vec3 q, const vec3 r );
 bool get_barycentric_coordinates	( const vec3 a, const vec3 b, const vec3 c, const vec3 &point, vec3 *result );
@@ -0,0 +1,128 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: island.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "island.h"
+
+
+float IslandBuilder::linear_threshold	= 0.05f;
+float IslandBuilder::angular_threshold	= 0.05f;
+float IslandBuilder::time_to_sleep		= 0.5f;
+
+/**
+* @brief	join the awake bodies connected by contacts, static bodies do not join islands
+*			so a floor does not merge everything resting on it
+* @param bodies
+* @param contacts	contacts of the current step
+*/
+void IslandBuilder::build( std::vector<RigidBody>& bodies, const std::vector<ContactManifold>& contacts )
+{
+	m_parent.resize( bodies.size() );
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+		m_parent[i] = i;
+
+	// O(m * a(n))
+	for ( const ContactManifold& contact : contacts )
+	{
+		if ( contact.body_A->is_awake() == false || contact.body_B->is_awake() == false )
+			continue;
+
+		unite( static_cast<unsigned>( contact.body_A - bodies.data() ),
+			   static_cast<unsigned>( contact.body_B - bodies.data() ) );
+	}
+
+	m_island_count = 0u;
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		if ( bodies[i].is_awake() == false )
+			continue;
+
+		bodies[i].island = find( i );
+
+		if ( bodies[i].island == i )
+			m_island_count++;
+	}
+}
+
+/**
+* @brief	accumulate the time every body has been still, islands where every body has been
+*			still long enough fall asleep
+* @param bodies
+* @param dt
+*/
+void IslandBuilder::update_sleep( std::vector<RigidBody>& bodies, const float dt )
+{
+	const float linear_2 = linear_threshold * linear_threshold;
+	const float angular_2 = angular_threshold * angular_threshold;
+
+	m_island_sleep.assign( bodies.size(), std::numeric_limits<float>::max() );
+
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		RigidBody& body = bodies[i];
+
+		if ( body.is_awake() == false )
+			continue;
+
+		if ( glm::length2( body.linear_velocity ) > linear_2 || glm::length2( body.angular_velocity ) > angular_2 )
+			body.sleep_time = 0.0f;
+		else
+			body.sleep_time += dt;
+
+		// the island is as awake as its most awake body
+		m_island_sleep[body.island] = glm::min( m_island_sleep[body.island], body.sleep_time );
+	}
+
+	for ( RigidBody& body : bodies )
+	{
+		if ( body.is_awake() && m_island_sleep[body.island] >= time_to_sleep )
+			body.sleep();
+	}
+}
+
+/**
+* @brief get the number of islands of the last build
+* @return islands
+*/
+unsigned IslandBuilder::island_count() const
+{
+	return m_island_count;
+}
+
+/**
+* @brief find the root of the island of a body (path halving)
+* @param body
+* @return root body
+*/
+unsigned IslandBuilder::find( unsigned body )
+{
+	while ( m_parent[body] != body )
+	{
+		m_parent[body] = m_parent[m_parent[body]];
+		body = m_parent[body];
+	}
+
+	return body;
+}
+
+/**
+* @brief join the islands of two bodies
+* @param a
+* @param b
+*/
+void IslandBuilder::unite( const unsigned a, const unsigned b )
+{
+	const unsigned root_a = find( a );
+	const unsigned root_b = find( b );
+
+	// the lowest index is the root so the island ids do not depend on the contact order
+	if ( root_a < root_b )
+		m_parent[root_b] = root_a;
+	else if ( root_b < root_a )
+		m_parent[root_a] = root_b;
+}
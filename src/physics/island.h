@@ -0,0 +1,38 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: island.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+
+#include <vector>
+
+class IslandBuilder
+{
+public:
+	void build			( std::vector<RigidBody>& bodies, const std::vector<ContactManifold>& contacts );
+	void update_sleep	( std::vector<RigidBody>& bodies, const float dt );
+
+	unsigned island_count() const;
+
+public:
+	static float linear_threshold;		// bodies slower than this can sleep
+	static float angular_threshold;		// bodies rotating slower than this can sleep
+	static float time_to_sleep;			// time an island has to be still before sleeping
+
+private:
+	unsigned find	( unsigned body );
+	void	 unite	( const unsigned a, const unsigned b );
+
+private:
+	std::vector<unsigned>	m_parent;		// union-find forest of the awake bodies
+	std::vector<float>		m_island_sleep;	// minimum sleep time of the bodies of each island (by root)
+	unsigned				m_island_count{ 0u };
+};
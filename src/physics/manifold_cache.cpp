@@ -0,0 +1,237 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: manifold_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "manifold_cache.h"
+#include "profiler.h"
+
+
+float ManifoldCache::max_translation = 0.005f;
+float ManifoldCache::max_rotation = 0.01f;
+
+
+/**
+* @brief get the manifold of a pair of bodies in the order given
+* @param body_A
+* @param body_B
+* @return manifold of the pair, null if it was not in contact
+*/
+PersistentManifold* ManifoldCache::find( const unsigned body_A, const unsigned body_B )
+{
+	auto it = m_manifolds.find( static_cast<unsigned long long>( body_A ) << 32u | body_B );
+	if ( it == m_manifolds.end() )
+		return nullptr;
+
+	it->second.step = m_step;
+	it->second.refreshed = false;
+
+	return &it->second;
+}
+
+/**
+* @brief keep the result of the full query of a pair, separated pairs are removed
+* @param body_A			index of the first body
+* @param body_B			index of the second body
+* @param rigid_body_A
+* @param rigid_body_B
+* @param contact_data	manifold of the query, null if the bodies are not colliding
+* @param transform_A	transformation of the first body from the cache of the step
+* @param transform_B	transformation of the second body from the cache of the step
+*/
+void ManifoldCache::store( const unsigned body_A, const unsigned body_B, const RigidBody& rigid_body_A, const RigidBody& rigid_body_B, const ContactManifold* contact_data,
+						   const BodyTransform& transform_A, const BodyTransform& transform_B )
+{
+	const unsigned long long key = static_cast<unsigned long long>( body_A ) << 32u | body_B;
+	if ( contact_data == nullptr )
+	{
+		m_manifolds.erase( key );
+		return;
+	}
+
+	PersistentManifold& manifold = m_manifolds[key];
+	manifold.step = m_step;
+	manifold.refreshed = false;
+	store_manifold( manifold, rigid_body_A, rigid_body_B, contact_data, transform_A, transform_B );
+}
+
+/**
+* @brief count the reprojected pairs of the step and evict the pairs that were not queried in it
+*/
+void ManifoldCache::end_step()
+{
+	m_queries = 0u;
+	m_refreshed = 0u;
+
+	for ( auto it = m_manifolds.begin(); it != m_manifolds.end(); )
+	{
+		if ( it->second.step != m_step )
+		{
+			it = m_manifolds.erase( it );
+			continue;
+		}
+
+		m_queries++;
+		if ( it->second.refreshed == true )
+			m_refreshed++;
+		it++;
+	}
+
+	m_step++;
+}
+
+/**
+* @brief remove every cached pair
+*/
+void ManifoldCache::clear()
+{
+	m_manifolds.clear();
+	m_queries = 0u;
+	m_refreshed = 0u;
+}
+
+/**
+* @brief get the number of cached pairs
+* @return pairs
+*/
+unsigned ManifoldCache::size() const
+{
+	return static_cast<unsigned>( m_manifolds.size() );
+}
+
+/**
+* @brief get the number of pairs queried in the last step
+* @return pairs
+*/
+unsigned ManifoldCache::queries() const
+{
+	return m_queries;
+}
+
+/**
+* @brief get the number of pairs reprojected in the last step
+* @return pairs
+*/
+unsigned ManifoldCache::refreshed() const
+{
+	return m_refreshed;
+}
+
+/**
+* @brief	cosine of the angle between the rotations of two relative transformations from the
+*			model space of B to the model space of A, without the scales of the bodies
+* @param a			linear part of the first transformation
+* @param b			linear part of the second transformation
+* @param scale_A
+* @param scale_B
+* @return cosine of the rotation from one to the other
+*/
+static float rotation_cosine( const mat3& a, const mat3& b, const vec3& scale_A, const vec3& scale_B )
+{
+	// trace of the rotation between them, 1 + 2 cos( angle ). The rotations are the columns
+	// scaled by A and divided by the scale of B
+	float trace = 0.0f;
+	for ( unsigned i = 0u; i < 3u; i++ )
+		trace += dot( a[i] * scale_A, b[i] * scale_A ) / ( scale_B[i] * scale_B[i] );
+
+	return ( trace - 1.0f ) * 0.5f;
+}
+
+/**
+* @brief	rebuild the manifold of the last full query from the current transforms. Every point of
+*			body B is projected again on the reference plane of body A, the points that left it
+*			are dropped and the rest keep their features for the warm start
+* @param manifold
+* @param body_A		first body of the pair
+* @param body_B		second body of the pair
+* @param contact_data	return reprojected manifold
+* @param transform_A	transformation of the first body from the cache of the step
+* @param transform_B	transformation of the second body from the cache of the step
+* @return the manifold was reprojected, otherwise the narrowphase has to run
+*/
+bool refresh_manifold( PersistentManifold& manifold, RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data,
+					   const BodyTransform& transform_A, const BodyTransform& transform_B )
+{
+	if ( manifold.valid == false )
+		return false;
+
+	// the pose of B in A moved too much since the full query, the translation in the
+	// orientation of A without its scale
+	const Transform relative = transform_A.inverse * transform_B.model;
+	const vec3 translation = ( relative.translation - manifold.relative.translation ) * body_A.scl;
+
+	if ( glm::length2( translation ) > ManifoldCache::max_translation * ManifoldCache::max_translation )
+		return false;
+	if ( rotation_cosine( manifold.relative.linear, relative.linear, body_A.scl, body_B.scl ) < std::cos( ManifoldCache::max_rotation ) )
+		return false;
+
+	RigidBody& reference = manifold.swapped ? body_B : body_A;
+	RigidBody& incident = manifold.swapped ? body_A : body_B;
+	const BodyTransform& reference_transform = manifold.swapped ? transform_B : transform_A;
+	const BodyTransform& incident_transform = manifold.swapped ? transform_A : transform_B;
+
+	ContactManifold contact;
+	contact.normal = transpose( reference_transform.inverse.linear ) * manifold.local_normal;
+	contact.feature = manifold.feature;
+	contact.body_A = &reference;
+	contact.body_B = &incident;
+
+	for ( const PersistentPoint& point : manifold.points )
+	{
+		const vec3 point_A = reference_transform.model.point( point.local_A );
+		const vec3 point_B = incident_transform.model.point( point.local_B );
+
+		const float depth = dot( contact.normal, point_A - point_B );
+		if ( depth < 0.0f )
+			continue;
+
+		contact.points.push_back( ContactPoint{ point_B + contact.normal * depth, point_B, depth, 0.0f, 0.0f, point.feature } );
+	}
+
+	if ( contact.points.empty() )
+		return false;
+
+	contact_data = contact;
+	manifold.refreshed = true;
+	PROFILE_COUNT( ProfileCounter::RefreshedManifolds, 1u );
+
+	return true;
+}
+
+/**
+* @brief keep the result of a full query of a pair in the model space of its bodies
+* @param manifold
+* @param body_A			first body of the pair
+* @param body_B			second body of the pair
+* @param contact_data	manifold of the query, null if the bodies are not colliding
+* @param transform_A	transformation of the first body from the cache of the step
+* @param transform_B	transformation of the second body from the cache of the step
+*/
+void store_manifold( PersistentManifold& manifold, const RigidBody& body_A, const RigidBody& body_B, const ContactManifold* contact_data,
+					 const BodyTransform& transform_A, const BodyTransform& transform_B )
+{
+	manifold.valid = contact_data != nullptr && contact_data->points.empty() == false;
+	if ( manifold.valid == false )
+		return;
+
+	manifold.relative = transform_A.inverse * transform_B.model;
+
+	manifold.swapped = contact_data->body_A != &body_A;
+	const BodyTransform& reference = manifold.swapped ? transform_B : transform_A;
+	const BodyTransform& incident = manifold.swapped ? transform_A : transform_B;
+
+	// the transpose of the model keeps the normal through the inverse transpose of the refresh
+	manifold.local_normal = transpose( reference.model.linear ) * contact_data->normal;
+	manifold.feature = contact_data->feature;
+
+	manifold.points.clear();
+	for ( const ContactPoint& point : contact_data->points )
+	{
+		// point_B is on the reference face of body A, point_A on body B
+		manifold.points.push_back( PersistentPoint{ reference.inverse.point( point.point_B ), incident.inverse.point( point.point_A ), point.feature } );
+	}
+}
@@ -0,0 +1,73 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: manifold_cache.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+#include "transform.h"
+
+#include <unordered_map>
+
+// point of a persistent manifold in the model space of the bodies of the manifold
+struct PersistentPoint
+{
+	vec3		local_A;	// on the reference face of body A
+	vec3		local_B;	// on body B
+	unsigned	feature;
+};
+
+// last manifold of a pair of bodies, reprojected while they barely move relative to each other
+struct PersistentManifold
+{
+	FixedVector<PersistentPoint, max_manifold_points> points;
+
+	vec3		local_normal;			// in the model space of body A of the manifold, as a normal
+	unsigned	feature{ 0u };
+	bool		swapped{ false };		// body A of the manifold is the second body of the pair
+
+	// model space of the second body of the pair to the model space of the first one when the
+	// manifold was built
+	Transform	relative;
+
+	bool		valid{ false };			// the pair was colliding in the last full query
+	unsigned	step{ 0u };				// last step the pair was queried
+	bool		refreshed{ false };		// the manifold was reprojected in that step
+};
+
+// last manifold of every pair in contact, the narrowphase only runs when it cannot be reprojected
+class ManifoldCache
+{
+public:
+	PersistentManifold* find	( const unsigned body_A, const unsigned body_B );
+	void				store	( const unsigned body_A, const unsigned body_B, const RigidBody& rigid_body_A, const RigidBody& rigid_body_B, const ContactManifold* contact_data,
+								  const BodyTransform& transform_A, const BodyTransform& transform_B );
+	void				end_step();
+	void				clear();
+
+	unsigned size		() const;
+	unsigned queries	() const;
+	unsigned refreshed	() const;
+
+public:
+	static float max_translation;	// relative motion of the bodies that still reprojects the points
+	static float max_rotation;		// in radians
+
+private:
+	std::unordered_map<unsigned long long, PersistentManifold> m_manifolds;	// by pair of bodies in contact
+
+	unsigned m_step{ 1u };
+	unsigned m_queries{ 0u };		// pairs queried in the last step
+	unsigned m_refreshed{ 0u };		// pairs reprojected in the last step
+};
+
+bool refresh_manifold	( PersistentManifold& manifold, RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data,
+						  const BodyTransform& transform_A, const BodyTransform& transform_B );
+void store_manifold		( PersistentManifold& manifold, const RigidBody& body_A, const RigidBody& body_B, const ContactManifold* contact_data,
+						  const BodyTransform& transform_A, const BodyTransform& transform_B );
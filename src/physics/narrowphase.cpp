@@ -0,0 +1,140 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: narrowphase.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "narrowphase.h"
+#include "half_edge.h"
+#include "box_collision.h"
+#include "sphere_collision.h"
+
+#include <functional>
+
+
+unsigned NarrowphasePolicy::gjk_vertex_count = 32u;
+
+/**
+* @brief routine of a pair of shapes with the bodies in the other order
+*/
+template <ShapeOverlap overlap>
+static bool swapped( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const BodyTransform& transform_A, const BodyTransform& transform_B )
+{
+	return overlap( body_B, body_A, contact_data, transform_B, transform_A );
+}
+
+// routine of every pair of shapes, by the shape of A and B. Null pairs use the hull queries
+static const ShapeOverlap shape_overlaps[4][4] =
+{
+	//	Hull				Box					Sphere					Capsule
+	{	nullptr,			nullptr,			swapped<overlap_sphere>,	swapped<overlap_capsule>	},	// Hull
+	{	nullptr,			overlap_box_box,	swapped<overlap_sphere>,	swapped<overlap_capsule>	},	// Box
+	{	overlap_sphere,		overlap_sphere,		overlap_sphere,				overlap_sphere				},	// Sphere
+	{	overlap_capsule,	overlap_capsule,	swapped<overlap_sphere>,	overlap_capsule				},	// Capsule
+};
+
+
+/**
+* @brief key of a pair of meshes, independent of their order
+*/
+static std::pair<const HalfEdgeMesh*, const HalfEdgeMesh*> pair_key( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B )
+{
+	return std::less<const HalfEdgeMesh*>()( mesh_A, mesh_B ) ? std::make_pair( mesh_A, mesh_B ) : std::make_pair( mesh_B, mesh_A );
+}
+
+/**
+* @brief check which algorithm a pair of meshes uses
+* @param mesh_A
+* @param mesh_B
+* @return gjk and epa, otherwise sat
+*/
+bool NarrowphasePolicy::use_gjk( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B ) const
+{
+	NarrowphaseType type = m_type;
+
+	if ( m_pair_types.empty() == false )
+	{
+		auto it = m_pair_types.find( pair_key( mesh_A, mesh_B ) );
+		if ( it != m_pair_types.end() )
+			type = it->second;
+	}
+
+	if ( type != NarrowphaseType::Auto )
+		return type == NarrowphaseType::Gjk;
+
+	// the cost of sat grows with the product of the sizes of the meshes
+	const unsigned long long vertices = static_cast<unsigned long long>( mesh_A->vertices().size() ) * mesh_B->vertices().size();
+	return vertices >= static_cast<unsigned long long>( gjk_vertex_count ) * gjk_vertex_count;
+}
+
+/**
+* @brief find the closed form routine of a pair of shapes
+* @param shape_A
+* @param shape_B
+* @return routine, null if the pair uses sat or gjk
+*/
+ShapeOverlap NarrowphasePolicy::shape_overlap( const ShapeType shape_A, const ShapeType shape_B ) const
+{
+	if ( m_shape_routines == false )
+		return nullptr;
+
+	return shape_overlaps[static_cast<unsigned>( shape_A )][static_cast<unsigned>( shape_B )];
+}
+
+/**
+* @brief change the algorithm of the pairs without their own type
+* @param type
+*/
+void NarrowphasePolicy::set_type( const NarrowphaseType type )
+{
+	m_type = type;
+}
+
+/**
+* @brief force the algorithm of a pair of meshes
+* @param mesh_A
+* @param mesh_B
+* @param type
+*/
+void NarrowphasePolicy::set_pair_type( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const NarrowphaseType type )
+{
+	m_pair_types[pair_key( mesh_A, mesh_B )] = type;
+}
+
+/**
+* @brief remove the types of every pair
+*/
+void NarrowphasePolicy::clear_pairs()
+{
+	m_pair_types.clear();
+}
+
+/**
+* @brief use the closed form routines of the shapes that have one
+* @param enabled
+*/
+void NarrowphasePolicy::set_shape_routines( const bool enabled )
+{
+	m_shape_routines = enabled;
+}
+
+/**
+* @brief get the algorithm of the pairs without their own type
+* @return type
+*/
+NarrowphaseType NarrowphasePolicy::type() const
+{
+	return m_type;
+}
+
+/**
+* @brief check if the shapes use their closed form routines
+* @return enabled
+*/
+bool NarrowphasePolicy::shape_routines() const
+{
+	return m_shape_routines;
+}
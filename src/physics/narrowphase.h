@@ -0,0 +1,57 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: narrowphase.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+#include "transform.h"
+
+#include <map>
+#include <utility>
+
+enum class NarrowphaseType
+{
+	Sat,
+	Gjk,
+	Auto,		// by the vertex count of the meshes
+};
+
+// closed form collision of a pair of shapes, in the order of the arguments, with the
+// transformations of the bodies from the cache of the step
+typedef bool ( *ShapeOverlap )( RigidBody& body_A, RigidBody& body_B, ContactManifold& contact_data, const BodyTransform& transform_A, const BodyTransform& transform_B );
+
+// picks the algorithm of the narrowphase for every pair of meshes
+class NarrowphasePolicy
+{
+public:
+	bool use_gjk( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B ) const;
+	ShapeOverlap shape_overlap( const ShapeType shape_A, const ShapeType shape_B ) const;
+
+	void set_type		( const NarrowphaseType type );
+	void set_pair_type	( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const NarrowphaseType type );
+	void clear_pairs	();
+	void set_shape_routines( const bool enabled );
+
+	NarrowphaseType type() const;
+	bool shape_routines() const;
+
+public:
+	// pairs whose vertex counts have a geometric mean of at least this use gjk in Auto. Both
+	// are close below the cylinder (26) in the collision.sat_vs_gjk benchmark, where sat keeps
+	// its better manifolds, and gjk is several times faster from the sphere (122)
+	static unsigned gjk_vertex_count;
+
+private:
+	NarrowphaseType m_type{ NarrowphaseType::Auto };
+	bool m_shape_routines{ true };		// otherwise every pair uses the generic hull queries
+
+	// by pair of meshes, the first one the lowest, over m_type
+	std::map<std::pair<const HalfEdgeMesh*, const HalfEdgeMesh*>, NarrowphaseType> m_pair_types;
+};
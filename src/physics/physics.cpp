@@ -10,11 +10,11 @@ Creation date: 01/27/2020
 #include "physics.h"
 
 #include "collision.h"
-#include "camera.h"
-#include "graphics.h"
+#include "gjk.h"
+#include "profiler.h"
+#include "sweep_and_prune.h"
 
 #include "math_utils.h"
-#include <imgui/imgui.h>
 #include <string>
 
 
@@ -29,36 +29,52 @@ Physics & Physics::get_instance()
 }
 
 /**
-* @brief initialize physics
+* @brief build the half edge mesh of a render mesh, its coplanar triangles merged into faces
+* @param mesh
+* @param render_mesh_id		render mesh drawn for the bodies using the half edge mesh
+* @return new half edge mesh, owned by the caller
 */
-void Physics::initialize()
+HalfEdgeMesh* create_half_edge_mesh( const Mesh& mesh, const unsigned render_mesh_id )
 {
-	auto& meshes = Graphics::get_instance().meshes();
+	HalfEdgeMesh* phy_mesh = new HalfEdgeMesh;
+	phy_mesh->set_render_mesh_id( render_mesh_id );
+	phy_mesh->add_vertices( mesh.vertices );
+	for ( unsigned i = 0; i < mesh.indices.size(); i++ )
+		phy_mesh->add_face(	mesh.indices[i].x,
+							mesh.indices[i].y,
+							mesh.indices[i].z );
+
+	phy_mesh->link_twins();
+	phy_mesh->merge_faces();
+	phy_mesh->set_indices();
+
+	if ( phy_mesh->vertices().size() >= HalfEdgeMesh::hierarchy_vertex_count )
+		phy_mesh->build_hierarchy();
+
+	return phy_mesh;
+}
 
+/**
+* @brief initialize physics
+* @param meshes	render meshes the physical meshes are built from
+*/
+void Physics::initialize( const std::vector<Mesh>& meshes )
+{
 	// create the half edge meshes from the physical meshes
 	for ( unsigned i = 0; i < meshes.size(); i++ )
-	{
-		HalfEdgeMesh* phy_mesh = new HalfEdgeMesh;
-		phy_mesh->set_render_mesh_id( i );
-		phy_mesh->add_vertices( meshes[i].vertices );
-		for ( unsigned j = 0; j < meshes[i].indices.size(); j++ )
-			phy_mesh->add_face(	meshes[i].indices[j].x,
-								meshes[i].indices[j].y,
-								meshes[i].indices[j].z );
-
-		phy_mesh->link_twins();
-		phy_mesh->merge_faces();
-		phy_mesh->set_indices();
-
-		m_meshes.push_back( phy_mesh );
-	}
+		m_meshes.push_back( create_half_edge_mesh( meshes[i], i ) );
+
+	m_thread_pool = new ThreadPool;
 
 	//SolverNaive* solver = new SolverNaive;
 	SolverConstraint* solver = new SolverConstraint;
-	solver->set_iteration_count( 20 );
+	solver->set_iteration_count( m_solver_iterations );
 	solver->set_baumgarte( 0.2f );
+	solver->set_mode( m_solver_mode );
+	solver->set_thread_pool( m_thread_pool );
 	m_collision_solver = reinterpret_cast<Solver*>( solver );
 
+	m_broadphase = create_broadphase( m_broadphase_type );
 
 	m_force_mult = 0.5f;
 	m_gravity = { 0.0f, -10.0f, 0.0f };
@@ -69,6 +85,8 @@ void Physics::initialize()
 */
 void Physics::update( const float dt )
 {
+	PROFILE_FRAME();
+
 	// clean colors DEBUG
 	if ( show_debug_colors == true )
 		for ( auto& color : m_colors )
@@ -79,61 +97,174 @@ void Physics::update( const float dt )
 
 
 
+	// find the candidate pairs
+	{
+		PROFILE_SCOPE( ProfilePhase::Broadphase );
+		m_broadphase->update( m_bodies );
+	}
+
 	// check collisions
-	std::vector<ContactManifold> contacts;
+	std::vector<ContactManifold>& contacts = m_contacts;
+	contacts.clear();
+	m_skipped_pairs.clear();
+	m_woken_islands.clear();
+	m_dropped_points = 0u;
 
-	if ( m_bodies.size() > 1u )
+	auto collide = [&]( const BodyPair& pair )
 	{
-		// check every body with the rest of bodies
-		for ( unsigned i = 0u; i < m_bodies.size() - 1u; i++ )
+		RigidBody& body_A = m_bodies[pair.body_A];
+		RigidBody& body_B = m_bodies[pair.body_B];
+
+		// transformations of the step, every query of the pair reads them
+		const BodyTransform& transform_A = m_transforms[pair.body_A];
+		const BodyTransform& transform_B = m_transforms[pair.body_B];
+
+		ContactManifold contact;
+
+		// the manifold of the last full query is reprojected while the pair barely moves,
+		// the contact of a sphere is cheaper to compute again
+		const bool persistent = m_manifold_caching && body_A.shape != ShapeType::Sphere && body_B.shape != ShapeType::Sphere;
+		PersistentManifold* manifold = persistent ? m_manifold_cache.find( pair.body_A, pair.body_B ) : nullptr;
+
+		bool colliding = false;
+		if ( manifold != nullptr && refresh_manifold( *manifold, body_A, body_B, contact, transform_A, transform_B ) )
+		{
+			colliding = true;
+			if ( m_sat_caching == true )
+				m_sat_cache.keep( pair.body_A, pair.body_B );
+		}
+		else
 		{
-			for ( unsigned j = i + 1u; j < m_bodies.size(); j++ )
+			if ( ShapeOverlap overlap = m_narrowphase.shape_overlap( body_A.shape, body_B.shape ) )
+				colliding = overlap( body_A, body_B, contact, transform_A, transform_B );
+			else
 			{
-				ContactManifold contact;
+				// relative transformation of the pair
+				const PairTransform transform = make_pair_transform( transform_A, transform_B );
 
-				if ( overlap_sat( m_bodies[i], m_bodies[j], contact ) )
+				if ( m_narrowphase.use_gjk( body_A.mesh, body_B.mesh ) )
+					colliding = overlap_gjk( body_A, body_B, contact, &transform );
+				else
 				{
-					contacts.push_back( contact );
-
-					// change colors DEBUG
-					if ( show_debug_colors == true )
-					{
-						m_colors[i] = vec4( 0.0f, 1.0f, 0.0f, 1.0f );
-						m_colors[j] = vec4( 0.0f, 1.0f, 0.0f, 1.0f );
-					}
+					// the axis that separated the pair in the last step is tested first
+					SeparatingAxis* axis = m_sat_caching ? &m_sat_cache.find( pair.body_A, pair.body_B ) : nullptr;
+					colliding = overlap_sat( body_A, body_B, contact, axis, &transform );
 				}
 			}
-		} // O(n^2)
-	}
 
+			// the deepest points that span the largest area are enough for the solver
+			if ( colliding == true )
+				m_dropped_points += reduce_manifold( contact, m_max_contact_points );
 
-	// apply gravity
-	for ( auto& body : m_bodies )
-		body.apply_impulse( body.position, m_gravity * dt * body.mass );
+			if ( persistent == true )
+				m_manifold_cache.store( pair.body_A, pair.body_B, body_A, body_B, colliding ? &contact : nullptr, transform_A, transform_B );
+		}
+
+		if ( colliding == false )
+			return;
+
+		contacts.push_back( contact );
+
+		// an awake body touching a sleeping one wakes its island up
+		if ( body_A.mass != 0.0f && body_A.awake == false )
+			m_woken_islands.push_back( body_A.island );
+		if ( body_B.mass != 0.0f && body_B.awake == false )
+			m_woken_islands.push_back( body_B.island );
+
+		// change colors DEBUG
+		if ( show_debug_colors == true )
+		{
+			m_colors[pair.body_A] = vec4( 0.0f, 1.0f, 0.0f, 1.0f );
+			m_colors[pair.body_B] = vec4( 0.0f, 1.0f, 0.0f, 1.0f );
+		}
+	};
 
+	for ( const BodyPair& pair : m_broadphase->pairs() )
+	{
+		// nothing moves in pairs without awake bodies
+		if ( m_bodies[pair.body_A].is_awake() == false && m_bodies[pair.body_B].is_awake() == false )
+		{
+			if ( m_bodies[pair.body_A].mass != 0.0f || m_bodies[pair.body_B].mass != 0.0f )
+				m_skipped_pairs.push_back( pair );
+			continue;
+		}
 
-	// DEBUG	
-	if ( show_debug_points == true )
+		collide( pair );
+	}
+
+	// the woken islands need their own contacts, which may wake more islands
+	while ( m_woken_islands.empty() == false )
 	{
-		for ( auto contact : contacts )
+		for ( const unsigned island : m_woken_islands )
+			wake_island( island );
+		m_woken_islands.clear();
+
+		for ( auto pair = m_skipped_pairs.begin(); pair != m_skipped_pairs.end(); )
 		{
-			// render contact points DEBUG
-			for ( auto point : contact.points )
+			if ( m_bodies[pair->body_A].is_awake() || m_bodies[pair->body_B].is_awake() )
 			{
-				Graphics::get_instance().debug_render( m_meshes[0u], point.point_B, vec3( 0.05f ), quat(), vec4( 0.0f, 0.5f, 0.8f, 1.0f ) );
-				Graphics::get_instance().debug_render( m_meshes[0u], point.point_A, vec3( 0.05f ), quat(), vec4( 0.0f, 0.5f, 0.8f, 1.0f ) );
+				collide( *pair );
+				pair = m_skipped_pairs.erase( pair );
+				continue;
 			}
+			pair++;
 		}
 	}
 
+	if ( m_sat_caching == true )
+		m_sat_cache.end_step();
+	if ( m_manifold_caching == true )
+		m_manifold_cache.end_step();
 
-	// apply contact solver
-	m_collision_solver->solve_collision( contacts, dt );
+	// join the bodies in contact
+	m_islands.build( m_bodies, contacts );
 
 
-	// update velocities and position of bodies
+	// apply gravity
 	for ( auto& body : m_bodies )
-		body.integrate( dt );
+		if ( body.is_awake() )
+			body.apply_impulse( body.position, m_gravity * dt * body.mass );
+
+
+	{
+		PROFILE_SCOPE( ProfilePhase::Solver );
+
+		// reuse the impulses of the last step
+		if ( m_warm_starting == true )
+			m_contact_cache.warm_start( contacts, m_bodies );
+
+		// apply contact solver
+		m_collision_solver->solve_collision( contacts, dt );
+
+		if ( m_warm_starting == true )
+			m_contact_cache.store( contacts, m_bodies );
+	}
+
+
+	// still islands fall asleep
+	if ( m_sleeping == true )
+		m_islands.update_sleep( m_bodies, dt );
+
+
+	// update velocities and position of bodies, the transformations of the moved ones are
+	// used by the queries until the next integration
+	{
+		PROFILE_SCOPE( ProfilePhase::Integration );
+		for ( unsigned i = 0u; i < m_bodies.size(); i++ )
+		{
+			if ( m_bodies[i].is_awake() == false )
+				continue;
+
+			m_bodies[i].integrate( dt );
+			m_transforms[i] = make_body_transform( m_bodies[i] );
+		}
+	}
+
+	// sleeping bodies DEBUG
+	if ( show_debug_colors == true )
+		for ( unsigned i = 0u; i < m_bodies.size(); i++ )
+			if ( m_bodies[i].mass != 0.0f && m_bodies[i].awake == false )
+				m_colors[i] = vec4( 0.3f, 0.3f, 0.8f, 1.0f );
 }
 
 /**
@@ -148,6 +279,11 @@ void Physics::exit()
 	clear();
 
 	delete m_collision_solver;
+	delete m_broadphase;
+	delete m_thread_pool;
+	m_collision_solver = nullptr;
+	m_broadphase = nullptr;
+	m_thread_pool = nullptr;
 }
 
 /**
@@ -156,6 +292,14 @@ void Physics::exit()
 void Physics::clear()
 {
 	m_bodies.clear();
+	m_transforms.clear();
+	m_colors.clear();
+	m_contact_cache.clear();
+	m_sat_cache.clear();
+	m_manifold_cache.clear();
+
+	if ( m_broadphase != nullptr )
+		m_broadphase->clear();
 }
 
 
@@ -172,6 +316,15 @@ const std::vector<RigidBody>& Physics::bodies() const
 	return m_bodies;
 }
 
+/**
+* @brief get the model to world transformation of the bodies
+* @return transformations, in the order of the bodies
+*/
+const std::vector<BodyTransform>& Physics::transforms() const
+{
+	return m_transforms;
+}
+
 /**
 * @brief get colors of bodies
 * @return colors
@@ -197,6 +350,112 @@ const std::vector<HalfEdgeMesh*> Physics::meshes() const
 void Physics::set_gravity( const vec3 gravity )
 {
 	m_gravity = gravity;
+	wake_all();
+}
+
+/**
+* @brief change the broadphase used to find the candidate pairs
+* @param type
+*/
+void Physics::set_broadphase( const BroadphaseType type )
+{
+	delete m_broadphase;
+
+	m_broadphase_type = type;
+	m_broadphase = create_broadphase( type );
+}
+
+/**
+* @brief change the iterations of the contact solver
+* @param iterations
+*/
+void Physics::set_solver_iterations( const int iterations )
+{
+	m_solver_iterations = iterations;
+
+	if ( SolverConstraint* solver = dynamic_cast<SolverConstraint*>( m_collision_solver ) )
+		solver->set_iteration_count( iterations );
+}
+
+/**
+* @brief change how the contact solver sweeps the constraints
+* @param mode
+*/
+void Physics::set_solver_mode( const SolverMode mode )
+{
+	m_solver_mode = mode;
+
+	if ( SolverConstraint* solver = dynamic_cast<SolverConstraint*>( m_collision_solver ) )
+		solver->set_mode( mode );
+}
+
+/**
+* @brief test the last separating axis of every pair before the full SAT query
+* @param enabled
+*/
+void Physics::set_sat_caching( const bool enabled )
+{
+	m_sat_caching = enabled;
+	m_sat_cache.clear();
+}
+
+/**
+* @brief let still islands fall asleep
+* @param enabled
+*/
+void Physics::set_sleeping( const bool enabled )
+{
+	m_sleeping = enabled;
+	if ( m_sleeping == false )
+		wake_all();
+}
+
+/**
+* @brief limit the points of every contact manifold
+* @param count	up to 4, 0 keeps every point
+*/
+void Physics::set_max_contact_points( const unsigned count )
+{
+	m_max_contact_points = count;
+}
+
+/**
+* @brief reproject the manifold of the last full query while a pair barely moves
+* @param enabled
+*/
+void Physics::set_manifold_caching( const bool enabled )
+{
+	m_manifold_caching = enabled;
+	m_manifold_cache.clear();
+}
+
+/**
+* @brief change the algorithm of the narrowphase
+* @param type	sat, gjk or chosen for every pair of meshes
+*/
+void Physics::set_narrowphase( const NarrowphaseType type )
+{
+	m_narrowphase.set_type( type );
+}
+
+/**
+* @brief use the closed form routines of the shapes, like box against box, over sat and gjk
+* @param enabled
+*/
+void Physics::set_shape_routines( const bool enabled )
+{
+	m_narrowphase.set_shape_routines( enabled );
+}
+
+/**
+* @brief force the algorithm of the narrowphase for a pair of meshes
+* @param mesh_A
+* @param mesh_B
+* @param type
+*/
+void Physics::set_pair_narrowphase( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const NarrowphaseType type )
+{
+	m_narrowphase.set_pair_type( mesh_A, mesh_B, type );
 }
 
 /**
@@ -206,6 +465,9 @@ void Physics::set_gravity( const vec3 gravity )
 void Physics::add_body( const RigidBody body )
 {
 	m_bodies.push_back( body );
+	m_bodies.back().update_world_inertia();
+	m_transforms.push_back( make_body_transform( body ) );
+
 	if ( show_debug_colors == true)
 		m_colors.push_back( vec4( 1.0f, 0.0f, 0.0f, 1.0f ) );
 	else
@@ -228,7 +490,10 @@ void Physics::push_object( Ray & ray )
 	// update forces in case of collision
 	if ( contact.time != -1.0f )
 	{
-		vec3 force = normalize( contact.position - Graphics::get_instance().camera().position() );
+		if ( body->awake == false )
+			wake_island( body->island );
+
+		vec3 force = normalize( contact.position - ray.origin );
 		body->apply_impulse( contact.position, force * m_force_mult );
 	}
 }
@@ -245,78 +510,59 @@ RigidBody* Physics::raycast_scene( Contact& contact, const Ray& ray )
 	RigidBody* result = nullptr;
 
 	// raycast bodies
-	for ( auto& body : m_bodies )
+	for ( unsigned i = 0u; i < m_bodies.size(); i++ )
 	{
-		Contact temp = raycast_body( ray, body );
+		Contact temp = raycast_body( ray, m_bodies[i], m_transforms[i] );
 		if ( contact.time == -1.0f || temp.time != -1.0f && temp.time < contact.time )
 		{
 			contact = temp;
-			result = &body;
+			result = &m_bodies[i];
 		}
 	}
 
 	return result;
 }
 
+/**
+* @brief wake up every sleeping body of an island
+* @param island
+*/
+void Physics::wake_island( const unsigned island )
+{
+	for ( auto& body : m_bodies )
+		if ( body.awake == false && body.island == island )
+			body.wake();
+}
+
+/**
+* @brief wake up every body
+*/
+void Physics::wake_all()
+{
+	for ( auto& body : m_bodies )
+		body.wake();
+}
+
 /**
 * @brief raycast against a body
+* @param ray
+* @param body
+* @param transform	model to world transformation of the body
 */
-Contact Physics::raycast_body( const Ray& ray, const RigidBody& body ) const
+Contact Physics::raycast_body( const Ray& ray, const RigidBody& body, const BodyTransform& transform ) const
 {
 	// transform the ray to body space
-	mat4 model		= body.model();
-	mat4 model_inv	= inverse( model );
-
 	Ray body_ray = ray;
-	body_ray.origin		= vec3( model_inv * vec4{ ray.origin, 1.0f } );
-	body_ray.direction	= vec3( model_inv * vec4{ ray.direction, 0.0f } );
+	body_ray.origin		= transform.inverse.point( ray.origin );
+	body_ray.direction	= transform.inverse.vector( ray.direction );
 
 	// check ray against body
 	Contact result	= intersection_ray_polyhedra( body_ray, body.mesh );
 
 	// translate the contact information back to world space
-	result.position = vec3( model * vec4( result.position, 1.0f ) );
-	result.normal	= vec3( model * vec4( result.normal, 0.0f ) );
+	result.position = transform.model.point( result.position );
+	result.normal	= transform.model.vector( result.normal );
 
 	return result;
 }
 
-/**
-* @brief show the bodies in the editor
-*/
-void Physics::show_in_editor()
-{
-	ImGui::Begin( "Physics" );
-	{
-		// physics
-		ImGui::DragFloat3( "Gravity", &m_gravity.x, 0.01f );
-		ImGui::Checkbox( "Debug Points", &show_debug_points );
-		ImGui::Checkbox( "Debug Colors", &show_debug_colors );
-
-		// bodies
-		for ( unsigned i = 0; i < m_bodies.size(); i++ )
-		{
-			std::string name = "RigidBody " + std::to_string( i );
-			if ( ImGui::TreeNode( name.c_str() ) )
-			{
-				vec3 euler = glm::degrees( glm::eulerAngles( m_bodies[i].rot ) );
-
-				ImGui::DragFloat3( "Position", &m_bodies[i].position.x, 0.01f );
-				ImGui::DragFloat3( "Scale", &m_bodies[i].scl.x, 0.01f );
-				ImGui::DragFloat3( "Rotation", &euler.x, 0.01f );
-				ImGui::DragFloat3( "Velocity", &m_bodies[i].linear_velocity.x, 0.01f );
-				ImGui::DragFloat3( "Angular Velocity", &m_bodies[i].angular_velocity.x, 0.01f );
-				ImGui::DragFloat3( "Linear Momentum", &m_bodies[i].linear_momentum.x, 0.01f );
-				ImGui::DragFloat3( "Angular Momentum", &m_bodies[i].angular_momentum.x, 0.01f );
-				ImGui::DragFloat( "Mass", &m_bodies[i].mass, 0.01f );
-
-				ImGui::TreePop();
-
-				
-
-				m_bodies[i].rot = normalize( quat( glm::radians( euler ) ) );
-			}
-
-		}
-	} ImGui::End();
-}
@@ -13,9 +13,19 @@ Creation date: 01/27/2020
 #include "rigid_body.h"
 #include "intersection.h"
 #include "solver.h"
+#include "broadphase.h"
+#include "island.h"
+#include "contact_cache.h"
+#include "sat_cache.h"
+#include "manifold_cache.h"
+#include "narrowphase.h"
+#include "transform.h"
+#include "mesh.h"
 
 #include <vector>
 
+HalfEdgeMesh* create_half_edge_mesh( const Mesh& mesh, const unsigned render_mesh_id = 0u );
+
 class Physics
 {
 private:
@@ -26,7 +36,7 @@ public:
 	static Physics& get_instance();
 
 	// loop control
-	void initialize	();
+	void initialize	( const std::vector<Mesh>& meshes );
 	void update		( const float dt );
 	void exit		();
 	void clear		();
@@ -34,27 +44,67 @@ public:
 public:
 	// gettors
 	const std::vector<RigidBody>&		bodies() const;
+	const std::vector<BodyTransform>&	transforms() const;
 	const std::vector<vec4>&			colors() const;
 	const std::vector<HalfEdgeMesh*>	meshes() const;
 
 	void set_gravity( const vec3 gravity );
+	void set_broadphase( const BroadphaseType type );
+	void set_solver_iterations( const int iterations );
+	void set_solver_mode( const SolverMode mode );
+	void set_sat_caching( const bool enabled );
+	void set_manifold_caching( const bool enabled );
+	void set_max_contact_points( const unsigned count );
+	void set_sleeping( const bool enabled );
+	void set_narrowphase( const NarrowphaseType type );
+	void set_shape_routines( const bool enabled );
+	void set_pair_narrowphase( const HalfEdgeMesh* mesh_A, const HalfEdgeMesh* mesh_B, const NarrowphaseType type );
 
 	void add_body( const RigidBody body );
 
+	// physics_editor.cpp
 	void show_in_editor();
+	void debug_draw() const;
 
 	void push_object( Ray& ray );
 
 	RigidBody* raycast_scene( Contact& contact, const Ray& ray );
 private:
-	Contact raycast_body( const Ray& ray, const RigidBody& body ) const;
+	Contact raycast_body( const Ray& ray, const RigidBody& body, const BodyTransform& transform ) const;
+
+	void wake_island( const unsigned island );
+	void wake_all();
 
 private:
 	std::vector<HalfEdgeMesh*>	m_meshes;
 	std::vector<RigidBody>		m_bodies;
+	std::vector<BodyTransform>	m_transforms;	// of every body, updated when it moves
 	std::vector<vec4>			m_colors;
+	std::vector<ContactManifold>	m_contacts;		// contacts of the last step
+
+	Solver*		m_collision_solver{ nullptr };
+	int			m_solver_iterations{ 4 };
+	SolverMode	m_solver_mode{ SolverMode::Sequential };
+	ThreadPool*	m_thread_pool{ nullptr };
+
+	ContactCache	m_contact_cache;
+	bool			m_warm_starting{ true };
+
+	NarrowphasePolicy	m_narrowphase;
+	SatCache			m_sat_cache;
+	bool				m_sat_caching{ true };
+	ManifoldCache		m_manifold_cache;
+	bool				m_manifold_caching{ true };
+	unsigned			m_max_contact_points{ 4u };		// 0 keeps every clipped point
+	unsigned			m_dropped_points{ 0u };			// by the reduction in the current step
+
+	Broadphase*		m_broadphase{ nullptr };
+	BroadphaseType	m_broadphase_type{ BroadphaseType::Tree };
 
-	Solver* m_collision_solver{ nullptr };
+	IslandBuilder			m_islands;
+	std::vector<BodyPair>	m_skipped_pairs;	// pairs without awake bodies in the current step
+	std::vector<unsigned>	m_woken_islands;	// sleeping islands touched in the current step
+	bool					m_sleeping{ true };
 
 	float m_force_mult;
 	vec3 m_gravity;
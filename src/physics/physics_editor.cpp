@@ -0,0 +1,161 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: physics_editor.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "physics.h"
+
+#include "sweep_and_prune.h"
+#include "graphics.h"
+
+#include <imgui/imgui.h>
+#include <string>
+
+// editor and debug rendering of the physics, not part of the headless build
+
+/**
+* @brief show the bodies in the editor
+*/
+void Physics::show_in_editor()
+{
+	ImGui::Begin( "Physics" );
+	{
+		// physics
+		if ( ImGui::DragFloat3( "Gravity", &m_gravity.x, 0.01f ) )
+			wake_all();
+		ImGui::Checkbox( "Debug Points", &show_debug_points );
+		ImGui::Checkbox( "Debug Colors", &show_debug_colors );
+
+		// broadphase
+		const char* broadphases[] = { "Brute Force", "AABB Tree", "Sweep and Prune", "Spatial Hash" };
+		int broadphase = static_cast<int>( m_broadphase_type );
+		if ( ImGui::Combo( "Broadphase", &broadphase, broadphases, IM_ARRAYSIZE( broadphases ) ) )
+			set_broadphase( static_cast<BroadphaseType>( broadphase ) );
+
+		ImGui::Text( "Pair tests: %u", m_broadphase->pair_tests() );
+		ImGui::Text( "Candidate pairs: %u", static_cast<unsigned>( m_broadphase->pairs().size() ) );
+
+		// solver
+		if ( SolverConstraint* solver = dynamic_cast<SolverConstraint*>( m_collision_solver ) )
+		{
+			if ( ImGui::SliderInt( "Solver Iterations", &m_solver_iterations, 1, 50 ) )
+				solver->set_iteration_count( m_solver_iterations );
+
+			const char* modes[] = { "Sequential", "Graph Colored", "Wide (" SIMD_NAME ")" };
+			int mode = static_cast<int>( m_solver_mode );
+			if ( ImGui::Combo( "Solver Mode", &mode, modes, IM_ARRAYSIZE( modes ) ) )
+			{
+				m_solver_mode = static_cast<SolverMode>( mode );
+				solver->set_mode( m_solver_mode );
+			}
+
+			ImGui::Text( "Colors: %u threads: %u", solver->color_count(), m_thread_pool->thread_count() );
+		}
+
+		if ( ImGui::Checkbox( "Warm Starting", &m_warm_starting ) && m_warm_starting == false )
+			m_contact_cache.clear();
+		ImGui::SliderFloat( "Warm Start Factor", &ContactCache::warm_start_factor, 0.0f, 1.0f );
+
+		ImGui::Text( "Cached pairs: %u warm started points: %u", m_contact_cache.size(), m_contact_cache.matched_points() );
+
+		// narrowphase
+		const char* narrowphases[] = { "SAT", "GJK + EPA", "Auto" };
+		int narrowphase = static_cast<int>( m_narrowphase.type() );
+		if ( ImGui::Combo( "Narrowphase", &narrowphase, narrowphases, IM_ARRAYSIZE( narrowphases ) ) )
+			m_narrowphase.set_type( static_cast<NarrowphaseType>( narrowphase ) );
+		int gjk_vertex_count = static_cast<int>( NarrowphasePolicy::gjk_vertex_count );
+		if ( ImGui::SliderInt( "GJK Vertex Count", &gjk_vertex_count, 4, 256 ) )
+			NarrowphasePolicy::gjk_vertex_count = static_cast<unsigned>( gjk_vertex_count );
+		bool shape_routines = m_narrowphase.shape_routines();
+		if ( ImGui::Checkbox( "Shape Routines", &shape_routines ) )
+			m_narrowphase.set_shape_routines( shape_routines );
+
+		if ( ImGui::Checkbox( "SAT Caching", &m_sat_caching ) && m_sat_caching == false )
+			m_sat_cache.clear();
+		ImGui::Text( "SAT queries: %u cached axis hits: %u", m_sat_cache.queries(), m_sat_cache.hits() );
+		if ( ImGui::Checkbox( "Persistent Manifolds", &m_manifold_caching ) && m_manifold_caching == false )
+			m_manifold_cache.clear();
+		ImGui::Text( "Manifold queries: %u refreshed: %u", m_manifold_cache.queries(), m_manifold_cache.refreshed() );
+		int max_contact_points = static_cast<int>( m_max_contact_points );
+		if ( ImGui::SliderInt( "Max Contact Points", &max_contact_points, 0, 4 ) )
+			m_max_contact_points = static_cast<unsigned>( max_contact_points );
+		ImGui::Text( "Dropped contact points: %u", m_dropped_points );
+
+		// sleeping
+		if ( ImGui::Checkbox( "Sleeping", &m_sleeping ) && m_sleeping == false )
+			wake_all();
+
+		unsigned awake = 0u;
+		for ( const auto& body : m_bodies )
+			if ( body.is_awake() )
+				awake++;
+
+		ImGui::Text( "Awake bodies: %u / %u", awake, static_cast<unsigned>( m_bodies.size() ) );
+		ImGui::Text( "Islands: %u", m_islands.island_count() );
+
+		if ( const BroadphaseSAP* sap = dynamic_cast<const BroadphaseSAP*>( m_broadphase ) )
+			ImGui::Text( "Pairs added: %u removed: %u", static_cast<unsigned>( sap->added_pairs().size() ),
+														static_cast<unsigned>( sap->removed_pairs().size() ) );
+
+		// bodies
+		for ( unsigned i = 0; i < m_bodies.size(); i++ )
+		{
+			std::string name = "RigidBody " + std::to_string( i );
+			if ( ImGui::TreeNode( name.c_str() ) )
+			{
+				vec3 euler = glm::degrees( glm::eulerAngles( m_bodies[i].rot ) );
+
+				bool edited = false;
+				edited |= ImGui::DragFloat3( "Position", &m_bodies[i].position.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Scale", &m_bodies[i].scl.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Rotation", &euler.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Velocity", &m_bodies[i].linear_velocity.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Angular Velocity", &m_bodies[i].angular_velocity.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Linear Momentum", &m_bodies[i].linear_momentum.x, 0.01f );
+				edited |= ImGui::DragFloat3( "Angular Momentum", &m_bodies[i].angular_momentum.x, 0.01f );
+				edited |= ImGui::DragFloat( "Mass", &m_bodies[i].mass, 0.01f );
+
+				// edited bodies wake up, static bodies may be supporting any island
+				if ( edited == true )
+				{
+					if ( m_bodies[i].mass == 0.0f )
+						wake_all();
+					else
+						wake_island( m_bodies[i].island );
+					m_bodies[i].wake();
+				}
+
+				ImGui::TreePop();
+
+				
+
+				m_bodies[i].rot = normalize( quat( glm::radians( euler ) ) );
+				m_bodies[i].update_world_inertia();
+				m_transforms[i] = make_body_transform( m_bodies[i] );
+			}
+
+		}
+	} ImGui::End();
+}
+
+/**
+* @brief render the contact points of the last step
+*/
+void Physics::debug_draw() const
+{
+	if ( show_debug_points == false )
+		return;
+
+	for ( const auto& contact : m_contacts )
+	{
+		for ( const auto& point : contact.points )
+		{
+			Graphics::get_instance().debug_render( m_meshes[0u], point.point_B, vec3( 0.05f ), quat(), vec4( 0.0f, 0.5f, 0.8f, 1.0f ) );
+			Graphics::get_instance().debug_render( m_meshes[0u], point.point_A, vec3( 0.05f ), quat(), vec4( 0.0f, 0.5f, 0.8f, 1.0f ) );
+		}
+	}
+}
@@ -9,6 +9,8 @@ Creation date: 01/28/2020
 ----------------------------------------------------------------------------------------------------------*/
 #include "rigid_body.h"
 
+#include <cassert>
+
 
 float RigidBody::epsilon = 0.00001f;
 
@@ -22,7 +24,7 @@ vec3 is_zero( vec3 v, const float epsilon )
 	vec3 r;
 
 	for ( unsigned i = 0u; i < 3; i++ )
-		r[i] = abs( v[i] ) < epsilon ? 0.0f : v[i];
+		r[i] = glm::abs( v[i] ) < epsilon ? 0.0f : v[i];
 
 	return r;
 }
@@ -77,8 +79,10 @@ void RigidBody::apply_impulse( const vec3 impulse_pos, const vec3 impulse_dir )
 
 	angular_momentum = is_zero( angular_momentum, epsilon );
 
-	mat3 I_inv = get_oriented_inv_I();
-	angular_velocity = I_inv * angular_momentum;
+	// the inertia was set without set_inertia or update_world_inertia
+	assert( I_inv_body == mat3( 0.0f ) || I_inv_world != mat3( 0.0f ) );
+
+	angular_velocity = I_inv_world * angular_momentum;
 }
 
 /**
@@ -95,8 +99,9 @@ void RigidBody::apply_angular_impulse( const vec3 impulse_dir )
 	angular_momentum += impulse_dir;
 	angular_momentum = is_zero( angular_momentum, epsilon );
 
-	mat3 I_inv = get_oriented_inv_I();
-	angular_velocity = I_inv * angular_momentum;
+	assert( I_inv_body == mat3( 0.0f ) || I_inv_world != mat3( 0.0f ) );
+
+	angular_velocity = I_inv_world * angular_momentum;
 }
 
 /**
@@ -111,6 +116,8 @@ void RigidBody::integrate( const float dt )
 	// rotation
 	quat delta_rot = 0.5f * quat( 0.0f, angular_velocity.x, angular_velocity.y, angular_velocity.z ) * rot;
 	rot = normalize( rot + delta_rot * dt );
+
+	update_world_inertia();
 }
 
 /**
@@ -126,10 +133,104 @@ float RigidBody::inv_mass() const
 }
 
 /**
-* @brief get oriented inverse inertia matrix
+* @brief get oriented inverse inertia matrix, cached since the last orientation change
 * @return mat3
 */
-mat3 RigidBody::get_oriented_inv_I() const
+const mat3& RigidBody::get_oriented_inv_I() const
+{
+	return I_inv_world;
+}
+
+/**
+* @brief	recompute the world rotation and inverse inertia, must be called every time the
+*			orientation or the inertia of the body change
+*/
+void RigidBody::update_world_inertia()
+{
+	rotation = glm::mat3_cast( rot );
+	I_inv_world = rotation * I_inv_body * transpose( rotation );
+}
+
+/**
+* @brief	set the body space inertia tensor and its inverse, a zero tensor has no rotational
+*			response. Also the world inverse inertia of the current orientation
+* @param inertia	inertia tensor in body space
+*/
+void RigidBody::set_inertia( const mat3& inertia )
+{
+	I_body = inertia;
+	I_inv_body = inertia == mat3( 0.0f ) ? mat3( 0.0f ) : inverse( inertia );
+
+	update_world_inertia();
+}
+
+/**
+* @brief check if the body is dynamic and awake
+* @return is awake
+*/
+bool RigidBody::is_awake() const
+{
+	return awake && mass != 0.0f;
+}
+
+/**
+* @brief wake the body up
+*/
+void RigidBody::wake()
+{
+	awake = true;
+	sleep_time = 0.0f;
+}
+
+/**
+* @brief put the body to sleep, it stops moving until it is woken up
+*/
+void RigidBody::sleep()
+{
+	awake = false;
+	sleep_time = 0.0f;
+
+	linear_momentum = vec3( 0.0f );
+	angular_momentum = vec3( 0.0f );
+	linear_velocity = vec3( 0.0f );
+	angular_velocity = vec3( 0.0f );
+}
+
+/**
+* @brief inertia tensor of a solid sphere
+* @param mass
+* @param radius
+* @return inertia tensor
+*/
+mat3 sphere_inertia_tensor( const float mass, const float radius )
+{
+	return mat3( 0.4f * mass * radius * radius );
+}
+
+/**
+* @brief	inertia tensor of a solid capsule along the y axis, a cylinder and two half spheres
+*			sharing the density
+* @param mass
+* @param radius
+* @param half_height	half of the length of the cylinder
+* @return inertia tensor
+*/
+mat3 capsule_inertia_tensor( const float mass, const float radius, const float half_height )
 {
-	return glm::mat3_cast( rot ) * I_inv_body * transpose( glm::mat3_cast( rot ) );;
+	const float height = 2.0f * half_height;
+	const float r2 = radius * radius;
+
+	// mass of the cylinder and of both half spheres, by their volumes
+	const float cylinder_volume = glm::pi<float>() * r2 * height;
+	const float sphere_volume = 4.0f / 3.0f * glm::pi<float>() * r2 * radius;
+	const float cylinder_mass = mass * cylinder_volume / ( cylinder_volume + sphere_volume );
+	const float sphere_mass = mass - cylinder_mass;
+
+	const float axial = cylinder_mass * r2 * 0.5f + sphere_mass * 0.4f * r2;
+	const float lateral = cylinder_mass * ( r2 * 0.25f + height * height / 12.0f ) +
+						  sphere_mass * ( 0.4f * r2 + height * height * 0.25f + 0.375f * height * radius );
+
+	return mat3( lateral, 0.0f,	 0.0f,
+				 0.0f,	  axial, 0.0f,
+				 0.0f,	  0.0f,	 lateral );
 }
@@ -13,19 +13,33 @@ Creation date: 01/28/2020
 #include "math_utils.h"
 
 
+// shape the narrowphase sees, every shape keeps its mesh for rendering and the generic queries
+enum class ShapeType
+{
+	Hull,		// any convex mesh
+	Box,		// the mesh is a box centered on the body
+	Sphere,		// radius from the mesh, the mesh is only drawn
+	Capsule,	// sphere swept along the y axis of the body
+};
+
 struct RigidBody
 {
 	static float epsilon; 
 
 	HalfEdgeMesh* mesh;
+	ShapeType shape{ ShapeType::Hull };
 
 	float mass;
 
 	mat3 I_body;
 	mat3 I_inv_body;
 
+	// world space values of the current orientation (see update_world_inertia and set_inertia)
+	mat3 rotation{ 1.0f };
+	mat3 I_inv_world{ 0.0f };
+
 	vec3 position{ 0.0f, 0.0f, 0.0f };
-	quat rot = quat();
+	quat rot = quat( 1.0f, 0.0f, 0.0f, 0.0f );
 	vec3 scl{ 1.0f, 1.0f, 1.0f };
 	vec3 linear_momentum{ 0.0f, 0.0f, 0.0f };
 	vec3 angular_momentum{ 0.0f, 0.0f, 0.0f };
@@ -36,6 +50,11 @@ struct RigidBody
 	float restitution{ 0.0f };
 	float friction{ 0.0f };
 
+	// sleeping
+	bool		awake{ true };
+	float		sleep_time{ 0.0f };	// time the body has been almost still
+	unsigned	island{ 0u };		// island the body belonged to when it fell asleep
+
 
 	const mat4 model() const;
 	void apply_force( const vec3 force_pos, const vec3 force_dir, const float dt );
@@ -43,5 +62,13 @@ struct RigidBody
 	void apply_angular_impulse( const vec3 impulse_dir );
 	void integrate( const float dt );
 	float inv_mass() const;
-	mat3 get_oriented_inv_I() const;
-};
\ No newline at end of file
+	const mat3& get_oriented_inv_I() const;
+	void update_world_inertia();
+	void set_inertia( const mat3& inertia );
+	bool is_awake() const;
+	void wake();
+	void sleep();
+};
+
+mat3 sphere_inertia_tensor ( const float mass, const float radius );
+mat3 capsule_inertia_tensor( const float mass, const float radius, const float half_height );
@@ -0,0 +1,104 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sat_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "sat_cache.h"
+
+
+/**
+* @brief	get the cached axis of a pair of bodies, an empty axis is created for new pairs.
+*			The axis is kept for the order given, the faces of A are the faces of body_A
+* @param body_A
+* @param body_B
+* @return axis of the pair
+*/
+SeparatingAxis& SatCache::find( const unsigned body_A, const unsigned body_B )
+{
+	const unsigned long long key = static_cast<unsigned long long>( body_A ) << 32u | body_B;
+
+	SeparatingAxis& axis = m_axes[key];
+	axis.step = m_step;
+	axis.hit = false;
+
+	return axis;
+}
+
+/**
+* @brief	keep the axis of a pair that skipped the query in this step, so its support vertices
+*			are not evicted and allocated again
+* @param body_A
+* @param body_B
+*/
+void SatCache::keep( const unsigned body_A, const unsigned body_B )
+{
+	auto it = m_axes.find( static_cast<unsigned long long>( body_A ) << 32u | body_B );
+	if ( it != m_axes.end() )
+		it->second.step = m_step;
+}
+
+/**
+* @brief count the hits of the step and evict the pairs that were not queried in it
+*/
+void SatCache::end_step()
+{
+	m_queries = 0u;
+	m_hits = 0u;
+
+	for ( auto it = m_axes.begin(); it != m_axes.end(); )
+	{
+		if ( it->second.step != m_step )
+		{
+			it = m_axes.erase( it );
+			continue;
+		}
+
+		m_queries++;
+		if ( it->second.hit == true )
+			m_hits++;
+		it++;
+	}
+
+	m_step++;
+}
+
+/**
+* @brief remove every cached pair
+*/
+void SatCache::clear()
+{
+	m_axes.clear();
+	m_queries = 0u;
+	m_hits = 0u;
+}
+
+/**
+* @brief get the number of cached pairs
+* @return pairs
+*/
+unsigned SatCache::size() const
+{
+	return static_cast<unsigned>( m_axes.size() );
+}
+
+/**
+* @brief get the number of pairs queried in the last step
+* @return pairs
+*/
+unsigned SatCache::queries() const
+{
+	return m_queries;
+}
+
+/**
+* @brief get the number of pairs separated by their cached axis in the last step
+* @return pairs
+*/
+unsigned SatCache::hits() const
+{
+	return m_hits;
+}
@@ -0,0 +1,62 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sat_cache.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "half_edge.h"
+
+#include <unordered_map>
+#include <vector>
+
+enum class SeparatingAxisType
+{
+	None,
+	FaceA,		// face of the first body of the pair
+	FaceB,		// face of the second body of the pair
+	Edge
+};
+
+// feature that separated a pair of bodies in the last query
+struct SeparatingAxis
+{
+	SeparatingAxisType type{ SeparatingAxisType::None };
+
+	unsigned		face_id{ 0u };
+	unsigned		edge_A{ no_edge };	// flat edge indices of the meshes
+	unsigned		edge_B{ no_edge };
+
+	// support vertex of the other body for every face of each body, where the next hill
+	// climbing of the face starts
+	std::vector<unsigned> supports_A;
+	std::vector<unsigned> supports_B;
+
+	unsigned step{ 0u };	// last step the pair was queried
+	bool	 hit{ false };	// the cached axis still separated the pair
+};
+
+// last separating axis of every candidate pair, tested before the full SAT query
+class SatCache
+{
+public:
+	SeparatingAxis& find( const unsigned body_A, const unsigned body_B );
+	void			keep( const unsigned body_A, const unsigned body_B );
+	void			end_step();
+	void			clear();
+
+	unsigned size	() const;
+	unsigned queries() const;
+	unsigned hits	() const;
+
+private:
+	std::unordered_map<unsigned long long, SeparatingAxis> m_axes;	// by pair of bodies
+
+	unsigned m_step{ 1u };
+	unsigned m_queries{ 0u };	// pairs queried in the last step
+	unsigned m_hits{ 0u };		// pairs separated by their cached axis in the last step
+};
@@ -11,6 +11,9 @@ Creation date: 03/11/2020
 #include "solver.h"
 #include "rigid_body.h"
 
+#include <cstdint>
+#include <limits>
+
 
 vec3 point_velocity( const RigidBody* body, const vec3 point );
 
@@ -19,7 +22,7 @@ vec3 point_velocity( const RigidBody* body, const vec3 point );
 * @brief solve the collision applying forces to the rigid bodies
 * @param contacts
 */
-void SolverNaive::solve_collision( std::vector<ContactManifold>& contacts, const float dt ) const
+void SolverNaive::solve_collision( std::vector<ContactManifold>& contacts, const float dt )
 {
 	/*
 		TO DO: implement naive collision solver using Baraff's notes
@@ -79,6 +82,8 @@ void SolverNaive::solve_collision( std::vector<ContactManifold>& contacts, const
 
 
 
+unsigned SolverConstraint::grain = 64u;
+
 /**
 * @brief set the iterations for the solver
 * @param iterations
@@ -98,155 +103,491 @@ void SolverConstraint::set_baumgarte( const float baumgarte )
 }
 
 /**
-* @brief solve the collision applying forces to the rigid bodies
+* @brief set how the constraints are swept
+* @param mode
+*/
+void SolverConstraint::set_mode( const SolverMode mode )
+{
+	m_mode = mode;
+}
+
+/**
+* @brief set the threads used by the colored mode, without them the batches run in this thread
+* @param pool
+*/
+void SolverConstraint::set_thread_pool( ThreadPool* pool )
+{
+	m_pool = pool;
+}
+
+/**
+* @brief get how the constraints are swept
+* @return mode
+*/
+SolverMode SolverConstraint::mode() const
+{
+	return m_mode;
+}
+
+/**
+* @brief get the number of colors of the last step (0 in the sequential mode)
+* @return colors
+*/
+unsigned SolverConstraint::color_count() const
+{
+	return m_batches.empty() ? 0u : static_cast<unsigned>( m_batches.size() - 1u );
+}
+
+/**
+* @brief get the constraints of the last step
+* @return constraints
+*/
+const std::vector<ContactConstraint>& SolverConstraint::constraints() const
+{
+	return m_constraints;
+}
+
+/**
+* @brief	solve the collision applying forces to the rigid bodies, the impulses already
+*			accumulated in the contacts are applied first (warm starting)
 * @param contacts
 */
-void SolverConstraint::solve_collision( std::vector<ContactManifold>& contacts, const float dt ) const
+void SolverConstraint::solve_collision( std::vector<ContactManifold>& contacts, const float dt )
 {
-	const float depth_threshold = 0.01f;
-	const float velocity_threshold = 1.0f;
+	prepare( contacts, dt );
 
-	for ( int i = 0u; i < m_iterations; i++ )
+	for_each_constraint( [this]( const ContactConstraint& constraint ) { warm_start( constraint ); } );
+
+	if ( m_mode == SolverMode::Wide )
 	{
-		for ( int j = 0; j < contacts.size(); j++ )
+		pack_wide();
+
+		for ( int i = 0u; i < m_iterations; i++ )
 		{
-			auto& contact = contacts[j];
+			for ( unsigned color = 0u; color < color_count(); color++ )
+			{
+				const unsigned begin = m_wide_batches[color];
+				run( m_wide_batches[color + 1u] - begin, grain / simd_width, [&]( const unsigned first, const unsigned last )
+				{
+					for ( unsigned j = begin + first; j < begin + last; j++ )
+						solve_wide( m_wide_constraints[j] );
+				} );
+			}
 
-			const vec3 n = contact.normal;
-			const vec3 cross_vec = { n.y, n.z, -n.x };
-			const vec3 u = cross( n, cross_vec );
-			const vec3 v = cross( n, u );
+			// constraints without a free color
+			for ( unsigned j = m_batches.back(); j < m_constraints.size(); j++ )
+				solve_constraint( m_constraints[j] );
+		}
 
-			// constant terms of effective mass
-			const float e_mass_1 = contact.body_A->inv_mass();
-			const float e_mass_2 = contact.body_B->inv_mass();
+		unpack_wide();
+	}
+	else
+	{
+		// only the velocities of the solver bodies change while iterating
+		for ( int i = 0u; i < m_iterations; i++ )
+			for_each_constraint( [this]( const ContactConstraint& constraint ) { solve_constraint( constraint ); } );
+	}
 
-			float total_impulse = 0.0f;
+	finish( contacts );
+}
 
-			const float restitution = contact.body_A->restitution * contact.body_B->restitution;
+/**
+* @brief	call a function for every constraint, in the colored mode the constraints of
+*			a color run in parallel and the colors one after another
+* @param function
+*/
+template <typename Function>
+void SolverConstraint::for_each_constraint( Function function )
+{
+	if ( m_mode == SolverMode::Sequential )
+	{
+		for ( const ContactConstraint& constraint : m_constraints )
+			function( constraint );
+		return;
+	}
 
-			for ( unsigned k = 0u; k < contact.points.size(); k++ )
-			{
-				auto& contact_point = contact.points[k];
+	for ( unsigned color = 0u; color < color_count(); color++ )
+	{
+		const unsigned begin = m_batches[color];
+		run( m_batches[color + 1u] - begin, grain, [&]( const unsigned first, const unsigned last )
+		{
+			for ( unsigned i = begin + first; i < begin + last; i++ )
+				function( m_constraints[i] );
+		} );
+	}
+
+	// constraints without a free color
+	for ( unsigned i = m_batches.back(); i < m_constraints.size(); i++ )
+		function( m_constraints[i] );
+}
+
+/**
+* @brief	pack the contacts in constraint rows with everything that is constant during the
+*			iterations
+* @param contacts
+* @param dt
+*/
+void SolverConstraint::prepare( std::vector<ContactManifold>& contacts, const float dt )
+{
+	m_bodies.clear();
+	m_constraints.clear();
+	m_body_map.clear();
+	m_batches.clear();
+
+	// open addressing table with at least twice the slots of the bodies in contact, it keeps its memory
+	std::size_t slots = 16u;
+	while ( slots < contacts.size() * 4u )
+		slots *= 2u;
+	m_body_map.assign( slots, std::make_pair( nullptr, 0u ) );
+
+	unsigned row_count = 0u;
+	for ( unsigned i = 0u; i < contacts.size(); i++ )
+	{
+		const ContactManifold& contact = contacts[i];
+
+		if ( contact.points.empty() )
+			continue;
+
+		ContactConstraint constraint;
+		constraint.first_row = row_count;
+		constraint.point_count = static_cast<unsigned>( contact.points.size() );
+		constraint.friction = contact.body_A->friction * contact.body_B->friction;
+		constraint.body_A = add_body( contact.body_A );
+		constraint.body_B = add_body( contact.body_B );
+		constraint.contact = i;
+		constraint.color = 0u;
+
+		m_constraints.push_back( constraint );
+		row_count += constraint.point_count + 3u;
+	}
+
+	// every constraint writes only its own rows
+	m_rows.resize( row_count );
+
+	auto fill = [&]( const unsigned begin, const unsigned end )
+	{
+		for ( unsigned i = begin; i < end; i++ )
+			fill_rows( m_constraints[i], contacts[m_constraints[i].contact], dt );
+	};
+
+	if ( m_mode == SolverMode::Sequential )
+	{
+		fill( 0u, static_cast<unsigned>( m_constraints.size() ) );
+	}
+	else
+	{
+		run( static_cast<unsigned>( m_constraints.size() ), grain, fill );
+		color_constraints();
+	}
+}
+
+/**
+* @brief get the solver body of a rigid body, creating it the first time
+* @param body
+* @return index of the solver body
+*/
+unsigned SolverConstraint::add_body( RigidBody* body )
+{
+	// fibonacci hash of the address, probing the next slots
+	const std::size_t mask = m_body_map.size() - 1u;
+	std::size_t slot = static_cast<std::size_t>( reinterpret_cast<std::uintptr_t>( body ) * 0x9E3779B97F4A7C15ull >> 32u ) & mask;
+	while ( m_body_map[slot].first != nullptr )
+	{
+		if ( m_body_map[slot].first == body )
+			return m_body_map[slot].second;
+		slot = ( slot + 1u ) & mask;
+	}
 
-				const vec3 point_A = contact_point.point_A;
-				const vec3 point_B = contact_point.point_B;
+	SolverBody solver_body;
+	solver_body.body = body;
+	solver_body.inv_mass = body->inv_mass();
 
-				// linear velocity of the contact points
-				const vec3 va = point_velocity( contact.body_A, point_A );
-				const vec3 vb = point_velocity( contact.body_B, point_B );
+	// static bodies do not react to impulses
+	if ( body->mass != 0.0f )
+	{
+		solver_body.inv_I = body->get_oriented_inv_I();
+		solver_body.linear_velocity = body->linear_momentum * solver_body.inv_mass;
+		solver_body.angular_velocity = solver_body.inv_I * body->angular_momentum;
+	}
+	else
+	{
+		solver_body.inv_I = mat3( 0.0f );
+		solver_body.linear_velocity = body->linear_velocity;
+		solver_body.angular_velocity = body->angular_velocity;
+	}
 
-				// position of the contact point respect to the body
-				const vec3 ra = point_A - contact.body_A->position;
-				const vec3 rb = point_B - contact.body_B->position;
+	solver_body.linear_velocity_0 = solver_body.linear_velocity;
+	solver_body.angular_velocity_0 = solver_body.angular_velocity;
 
-				// terms of inverse mass
-				const vec3 ra_n = cross( ra, n );
-				const vec3 rb_n = cross( rb, n );
+	const unsigned index = static_cast<unsigned>( m_bodies.size() );
+	m_bodies.push_back( solver_body );
+	m_body_map[slot] = std::make_pair( body, index );
 
-				// effective mass
-				const float e_mass_3 = glm::dot( ra_n, contact.body_A->I_inv_body * ra_n );
-				const float e_mass_4 = glm::dot( rb_n, contact.body_B->I_inv_body * rb_n );
+	return index;
+}
 
-				const float effective_mass = 1.0f / contact.points.size() * 1.0f / ( e_mass_1 + e_mass_2 + e_mass_3 + e_mass_4 );
+/**
+* @brief compute the rows of a contact manifold
+* @param constraint
+* @param contact
+* @param dt
+*/
+void SolverConstraint::fill_rows( const ContactConstraint& constraint, ContactManifold& contact, const float dt )
+{
+	const float depth_threshold = 0.01f;
+	const float velocity_threshold = 1.0f;
 
-				const float Jvn = dot( vb - va, n ); // collision
+	ConstraintRow* rows = m_rows.data() + constraint.first_row;
 
-				if ( i == 0 )
-					contact_point.Jv0 = Jvn;
+	const vec3 n = contact.normal;
+	const vec3 cross_vec = { n.y, n.z, -n.x };
+	const vec3 u = cross( n, cross_vec );
+	const vec3 v = cross( n, u );
 
-				const float depth_bias = -m_baumgarte * ( contact_point.depth - depth_threshold ) / dt; 
-				
-				const float restitution_bias = contact_point.Jv0 < -velocity_threshold ? restitution * contact_point.Jv0 : 0.0f;
+	const float restitution = contact.body_A->restitution * contact.body_B->restitution;
 
-				const float old_impulse = contact_point.impulse;
+	vec3 avg_point_A{ 0.0f };
+	vec3 avg_point_B{ 0.0f };
 
-				// acumulate impulse
-				contact_point.impulse += effective_mass * -( Jvn + depth_bias + restitution_bias );;
-				contact_point.impulse = glm::max( 0.0f, contact_point.impulse );
-				total_impulse += contact_point.impulse;
+	for ( unsigned k = 0u; k < constraint.point_count; k++ )
+	{
+		auto& contact_point = contact.points[k];
 
+		// position of the contact point respect to the body
+		const vec3 ra = contact_point.point_A - contact.body_A->position;
+		const vec3 rb = contact_point.point_B - contact.body_B->position;
 
-				// apply impulse
-				const vec3 impulse_dir = n * ( contact_point.impulse - old_impulse );
+		// relative velocity before any impulse, for the restitution
+		const vec3 va = point_velocity( contact.body_A, contact_point.point_A );
+		const vec3 vb = point_velocity( contact.body_B, contact_point.point_B );
+		contact_point.Jv0 = dot( vb - va, n );
 
-				contact.body_A->apply_impulse( point_A, -impulse_dir );
-				contact.body_B->apply_impulse( point_B,  impulse_dir );
-			}
+		const float depth_bias = -m_baumgarte * ( contact_point.depth - depth_threshold ) / dt;
+		const float restitution_bias = contact_point.Jv0 < -velocity_threshold ? restitution * contact_point.Jv0 : 0.0f;
 
-			// point average
-			vec3 avg_point_A{ 0.0f };
-			vec3 avg_point_B{ 0.0f };
-			for ( auto& point : contact.points )
-			{
-				avg_point_A += point.point_A;
-				avg_point_B += point.point_B;
-			}
-			avg_point_A /= contact.points.size();
-			avg_point_B /= contact.points.size();
+		fill_row( rows[k], constraint.body_A, constraint.body_B, n, cross( ra, n ), cross( rb, n ),
+				  depth_bias + restitution_bias, contact_point.impulse );
 
-			// position of the contact point respect to the body
-			const vec3 ra = avg_point_A - contact.body_A->position;
-			const vec3 rb = avg_point_B - contact.body_B->position;
+		avg_point_A += contact_point.point_A;
+		avg_point_B += contact_point.point_B;
+	}
 
-			// terms of inverse mass
-			const vec3 ra_u = cross( ra, u );
-			const vec3 rb_u = cross( rb, u );
-			const vec3 ra_v = cross( ra, v );
-			const vec3 rb_v = cross( rb, v );
+	avg_point_A /= constraint.point_count;
+	avg_point_B /= constraint.point_count;
 
-			// effective mass
-			const float e_mass_5 = glm::dot( ra_u, contact.body_A->I_inv_body * ra_u );
-			const float e_mass_6 = glm::dot( rb_u, contact.body_B->I_inv_body * rb_u );
+	// friction is applied at the average of the contact points
+	const vec3 ra = avg_point_A - contact.body_A->position;
+	const vec3 rb = avg_point_B - contact.body_B->position;
 
-			const float e_mass_7 = glm::dot( ra_v, contact.body_A->I_inv_body * ra_v );
-			const float e_mass_8 = glm::dot( rb_v, contact.body_B->I_inv_body * rb_v );
+	ConstraintRow* friction = rows + constraint.point_count;
+	fill_row( friction[0], constraint.body_A, constraint.body_B, u, cross( ra, u ), cross( rb, u ), 0.0f, contact.impulse_u );
+	fill_row( friction[1], constraint.body_A, constraint.body_B, v, cross( ra, v ), cross( rb, v ), 0.0f, contact.impulse_v );
+	fill_row( friction[2], constraint.body_A, constraint.body_B, vec3( 0.0f ), n, n, 0.0f, contact.impulse_t );
+}
 
-			const float effective_mass_u = 1.0f / ( e_mass_1 + e_mass_2 + e_mass_5 + e_mass_6 );
-			const float effective_mass_v = 1.0f / ( e_mass_1 + e_mass_2 + e_mass_7 + e_mass_8 );
-			const float effective_mass_t = 1.0f / ( dot( n, contact.body_A->get_oriented_inv_I() * n ) + dot( n, contact.body_B->get_oriented_inv_I() * n ) );
+/**
+* @brief compute a constraint row and its effective mass
+* @param row		row to fill
+* @param body_A
+* @param body_B
+* @param linear		linear jacobian of body B (negated for body A)
+* @param angular_A	angular jacobian of body A (negated)
+* @param angular_B	angular jacobian of body B
+* @param bias		velocity bias of the constraint
+* @param impulse	impulse accumulated in the last step
+*/
+void SolverConstraint::fill_row( ConstraintRow& row, const unsigned body_A, const unsigned body_B, const vec3& linear,
+								 const vec3& angular_A, const vec3& angular_B, const float bias, const float impulse )
+{
+	const SolverBody& a = m_bodies[body_A];
+	const SolverBody& b = m_bodies[body_B];
+
+	row.body_A = body_A;
+	row.body_B = body_B;
+	row.linear = linear;
+	row.angular_A = angular_A;
+	row.angular_B = angular_B;
+	row.inv_I_angular_A = a.inv_I * angular_A;
+	row.inv_I_angular_B = b.inv_I * angular_B;
+	row.bias = bias;
+	row.impulse = impulse;
+
+	const float inv_effective_mass = ( a.inv_mass + b.inv_mass ) * dot( linear, linear ) +
+									 dot( angular_A, row.inv_I_angular_A ) +
+									 dot( angular_B, row.inv_I_angular_B );
+
+	row.effective_mass = inv_effective_mass > 0.0f ? 1.0f / inv_effective_mass : 0.0f;
+}
 
-			// body angular velocity
-			const vec3 wa = contact.body_A->angular_velocity;
-			const vec3 wb = contact.body_B->angular_velocity;
+/**
+* @brief	greedy coloring of the constraints so no two constraints of a color share a dynamic
+*			body, then sort them by color with a counting sort. Static bodies are never written
+*			so they can be shared
+*/
+void SolverConstraint::color_constraints()
+{
+	m_body_colors.assign( m_bodies.size(), 0ull );
 
+	m_color_sizes.assign( max_colors + 1u, 0u );
 
-			// linear velocity of the average contact points
-			const vec3 va = point_velocity( contact.body_A, avg_point_A );
-			const vec3 vb = point_velocity( contact.body_B, avg_point_B );
+	for ( ContactConstraint& constraint : m_constraints )
+	{
+		const bool dynamic_A = m_bodies[constraint.body_A].inv_mass != 0.0f;
+		const bool dynamic_B = m_bodies[constraint.body_B].inv_mass != 0.0f;
+
+		unsigned long long used = 0ull;
+		if ( dynamic_A )
+			used |= m_body_colors[constraint.body_A];
+		if ( dynamic_B )
+			used |= m_body_colors[constraint.body_B];
+
+		// lowest free color, max_colors if there is none
+		unsigned color = 0u;
+		while ( color < max_colors && ( used >> color & 1ull ) )
+			color++;
+
+		constraint.color = color;
+		m_color_sizes[color]++;
+
+		if ( color == max_colors )
+			continue;
+
+		if ( dynamic_A )
+			m_body_colors[constraint.body_A] |= 1ull << color;
+		if ( dynamic_B )
+			m_body_colors[constraint.body_B] |= 1ull << color;
+	}
 
-			// jacovian for each axis
-			const float Jvu = dot( vb - va, u );
-			const float Jvv = dot( vb - va, v );
-			const float Jvt = dot( wb - wa, n );
+	// used colors
+	unsigned colors = 0u;
+	while ( colors < max_colors && m_color_sizes[colors] != 0u )
+		colors++;
 
-			const float impulse_u_old = contact.impulse_u;
-			const float impulse_v_old = contact.impulse_v;
-			const float impulse_t_old = contact.impulse_t;
+	// first constraint of every color
+	m_batches.assign( colors + 1u, 0u );
+	for ( unsigned color = 1u; color <= colors; color++ )
+		m_batches[color] = m_batches[color - 1u] + m_color_sizes[color - 1u];
 
+	// stable so the order does not depend on the threads
+	m_cursors.resize( max_colors + 1u );
+	for ( unsigned color = 0u; color <= max_colors; color++ )
+		m_cursors[color] = color < colors ? m_batches[color] : m_batches[colors];
 
-			contact.impulse_u += effective_mass_u * -Jvu;
-			contact.impulse_v += effective_mass_v * -Jvv;
-			contact.impulse_t += effective_mass_t * -Jvt;	// friction
+	m_sorted.resize( m_constraints.size() );
+	for ( const ContactConstraint& constraint : m_constraints )
+		m_sorted[m_cursors[constraint.color]++] = constraint;
 
+	m_constraints.swap( m_sorted );
+}
 
-			const float friction = contact.body_A->friction * contact.body_B->friction * total_impulse;
-			contact.impulse_u = glm::clamp( contact.impulse_u, -friction, friction );
-			contact.impulse_v = glm::clamp( contact.impulse_v, -friction, friction );
-			contact.impulse_t = glm::clamp( contact.impulse_t, -friction, friction );
+/**
+* @brief apply the impulses accumulated in the last step
+* @param constraint
+*/
+void SolverConstraint::warm_start( const ContactConstraint& constraint )
+{
+	const ConstraintRow* rows = m_rows.data() + constraint.first_row;
 
-			const vec3 impulse_dir = u * ( contact.impulse_u - impulse_u_old ) +
-									 v * ( contact.impulse_v - impulse_v_old );
+	for ( unsigned k = 0u; k < constraint.point_count + 3u; k++ )
+		apply_row( rows[k], rows[k].impulse );
+}
 
-			contact.body_A->apply_impulse( avg_point_A, -impulse_dir );
-			contact.body_B->apply_impulse( avg_point_B, impulse_dir );
+/**
+* @brief one iteration of the rows of a constraint
+* @param constraint
+*/
+void SolverConstraint::solve_constraint( const ContactConstraint& constraint )
+{
+	ConstraintRow* rows = m_rows.data() + constraint.first_row;
 
-			// twist
-			const vec3 impulse_twist = n * ( contact.impulse_t - impulse_t_old );
+	// non penetration
+	float total_impulse = 0.0f;
+	for ( unsigned k = 0u; k < constraint.point_count; k++ )
+	{
+		solve_row( rows[k], 0.0f, std::numeric_limits<float>::max() );
+		total_impulse += rows[k].impulse;
+	}
 
-			contact.body_A->apply_angular_impulse( -impulse_twist );
-			contact.body_B->apply_angular_impulse( impulse_twist );
-		}
+	// friction and twist
+	const float friction = constraint.friction * total_impulse;
+	for ( unsigned k = constraint.point_count; k < constraint.point_count + 3u; k++ )
+		solve_row( rows[k], -friction, friction );
+}
+
+/**
+* @brief apply an impulse along a row to the velocities of its bodies
+* @param row
+* @param impulse
+*/
+void SolverConstraint::apply_row( const ConstraintRow& row, const float impulse )
+{
+	SolverBody& a = m_bodies[row.body_A];
+	SolverBody& b = m_bodies[row.body_B];
+
+	// static bodies are shared by constraints solved at the same time, they are only read
+	if ( a.inv_mass != 0.0f )
+	{
+		a.linear_velocity	-= row.linear * ( impulse * a.inv_mass );
+		a.angular_velocity	-= row.inv_I_angular_A * impulse;
+	}
+	if ( b.inv_mass != 0.0f )
+	{
+		b.linear_velocity	+= row.linear * ( impulse * b.inv_mass );
+		b.angular_velocity	+= row.inv_I_angular_B * impulse;
+	}
+}
+
+/**
+* @brief accumulate the impulse of a row keeping it in the given range
+* @param row
+* @param min_impulse
+* @param max_impulse
+*/
+void SolverConstraint::solve_row( ConstraintRow& row, const float min_impulse, const float max_impulse )
+{
+	const SolverBody& a = m_bodies[row.body_A];
+	const SolverBody& b = m_bodies[row.body_B];
+
+	const float Jv = dot( row.linear, b.linear_velocity - a.linear_velocity ) +
+					 dot( row.angular_B, b.angular_velocity ) - dot( row.angular_A, a.angular_velocity );
+
+	const float old_impulse = row.impulse;
+	row.impulse = glm::clamp( old_impulse + row.effective_mass * -( Jv + row.bias ), min_impulse, max_impulse );
+
+	apply_row( row, row.impulse - old_impulse );
+}
+
+/**
+* @brief save the accumulated impulses in the contacts and the new velocities in the bodies
+* @param contacts
+*/
+void SolverConstraint::finish( std::vector<ContactManifold>& contacts )
+{
+	for ( const ContactConstraint& constraint : m_constraints )
+	{
+		ContactManifold& contact = contacts[constraint.contact];
+		const ConstraintRow* rows = m_rows.data() + constraint.first_row;
+
+		for ( unsigned k = 0u; k < constraint.point_count; k++ )
+			contact.points[k].impulse = rows[k].impulse;
+
+		contact.impulse_u = rows[constraint.point_count].impulse;
+		contact.impulse_v = rows[constraint.point_count + 1u].impulse;
+		contact.impulse_t = rows[constraint.point_count + 2u].impulse;
+	}
+
+	// the change of velocity is applied as momentum
+	for ( const SolverBody& solver_body : m_bodies )
+	{
+		RigidBody* body = solver_body.body;
+
+		if ( body->mass == 0.0f )
+			continue;
+
+		const mat3 I_world = body->rotation * body->I_body * transpose( body->rotation );
+
+		body->apply_impulse( body->position, ( solver_body.linear_velocity - solver_body.linear_velocity_0 ) * body->mass );
+		body->apply_angular_impulse( I_world * ( solver_body.angular_velocity - solver_body.angular_velocity_0 ) );
 	}
 }
 
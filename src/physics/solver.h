@@ -11,30 +11,189 @@ Creation date: 03/11/2020
 #pragma once
 
 #include "contact.h"
+#include "thread_pool.h"
+#include "simd.h"
+
+#include <utility>
 
 class Solver
 {
 public:
-	virtual void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) const = 0;
+	virtual ~Solver() = default;
+
+	virtual void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) = 0;
 };
 
 
 class SolverNaive : public Solver
 {
 public:
-	void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) const final;
+	void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) final;
+};
+
+
+// velocities of a body while the contacts are solved
+struct SolverBody
+{
+	RigidBody* body;
+
+	vec3 linear_velocity;
+	vec3 angular_velocity;
+
+	vec3 linear_velocity_0;		// velocities before solving
+	vec3 angular_velocity_0;
+
+	mat3  inv_I;				// world space inverse inertia
+	float inv_mass;
+};
+
+// one dimensional constraint between two bodies, the relative velocity along it is
+// dot( linear, v_B - v_A ) + dot( angular_B, w_B ) - dot( angular_A, w_A )
+struct ConstraintRow
+{
+	unsigned body_A;
+	unsigned body_B;
+
+	vec3 linear;
+	vec3 angular_A;
+	vec3 angular_B;
+
+	vec3 inv_I_angular_A;		// change of the angular velocities per unit of impulse
+	vec3 inv_I_angular_B;
+
+	float effective_mass;
+	float bias;
+	float impulse;				// accumulated impulse
+};
+
+// rows of a contact manifold: a row per point followed by the two friction rows and the twist row
+struct ContactConstraint
+{
+	unsigned first_row;
+	unsigned point_count;
+	float	 friction;
+
+	unsigned body_A;		// solver bodies
+	unsigned body_B;
+	unsigned contact;		// index of the manifold in the contacts
+	unsigned color;			// batch of the constraint in the colored mode
+};
+
+// a row of simd_width constraints of the same color, one constraint per lane
+struct alignas( 32 ) WideRow
+{
+	float linear[3][simd_width];
+	float angular_A[3][simd_width];
+	float angular_B[3][simd_width];
+	float inv_I_angular_A[3][simd_width];
+	float inv_I_angular_B[3][simd_width];
+	float effective_mass[simd_width];
+	float bias[simd_width];
+	float impulse[simd_width];
 };
 
+// simd_width constraints solved together: the normal rows followed by the friction and twist rows
+struct alignas( 32 ) WideConstraint
+{
+	float friction[simd_width];
+	float inv_mass_A[simd_width];
+	float inv_mass_B[simd_width];
+
+	unsigned body_A[simd_width];
+	unsigned body_B[simd_width];
+
+	unsigned first_row;			// wide rows
+	unsigned normal_rows;		// most points of the lanes, lanes with less points have empty rows
+	unsigned first_constraint;	// constraint of the first lane
+	unsigned lane_count;		// the last group of a color may not fill every lane
+};
+
+enum class SolverMode
+{
+	Sequential,		// one Gauss-Seidel sweep over the contacts in order
+	Colored,		// batches of constraints without shared dynamic bodies solved in parallel
+	Wide,			// colored batches solved simd_width constraints at a time
+};
+
+
 class SolverConstraint : public Solver
 {
 public:
 
 	void set_iteration_count( const int iterations );
 	void set_baumgarte( const float baumgarte );
-	void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) const final;
+	void set_mode( const SolverMode mode );
+	void set_thread_pool( ThreadPool* pool );
+	void solve_collision( std::vector<ContactManifold>& contacts, const float dt ) final;
+
+	SolverMode								mode		() const;
+	unsigned								color_count	() const;
+	const std::vector<ContactConstraint>&	constraints	() const;
+
+public:
+	static const unsigned max_colors = 64u;		// constraints that do not fit are solved sequentially
+	static unsigned		  grain;				// constraints per task in the colored mode
+
+private:
+	void	 prepare			( std::vector<ContactManifold>& contacts, const float dt );
+	unsigned add_body			( RigidBody* body );
+	void	 fill_rows			( const ContactConstraint& constraint, ContactManifold& contact, const float dt );
+	void	 fill_row			( ConstraintRow& row, const unsigned body_A, const unsigned body_B, const vec3& linear,
+								  const vec3& angular_A, const vec3& angular_B, const float bias, const float impulse );
+	void	 color_constraints	();
+	void	 warm_start			( const ContactConstraint& constraint );
+	void	 solve_constraint	( const ContactConstraint& constraint );
+	void	 apply_row			( const ConstraintRow& row, const float impulse );
+	void	 solve_row			( ConstraintRow& row, const float min_impulse, const float max_impulse );
+	void	 finish				( std::vector<ContactManifold>& contacts );
+
+	void	 pack_wide			();
+	void	 solve_wide			( const WideConstraint& constraint );
+	void	 unpack_wide		();
+
+	template <typename Function>
+	void for_each_constraint( Function function );
+	template <typename Function>
+	void run( const unsigned count, const unsigned grain, Function function );
 
 private:
 	int m_iterations;
 	float m_baumgarte{ 0.0f };
 
+	SolverMode	m_mode{ SolverMode::Sequential };
+	ThreadPool*	m_pool{ nullptr };
+
+	// flat arrays rebuilt every step (kept to reuse their memory)
+	std::vector<SolverBody>								m_bodies;
+	std::vector<ConstraintRow>							m_rows;
+	std::vector<ContactConstraint>						m_constraints;	// sorted by color in the colored mode
+	std::vector<std::pair<const RigidBody*, unsigned>>	m_body_map;		// solver body of every rigid body, hashed by address
+
+	// colored mode
+	std::vector<unsigned>			m_batches;		// first constraint of every color, the last one ends the colors
+	std::vector<unsigned long long>	m_body_colors;	// colors used by the constraints of every body
+	std::vector<unsigned>			m_color_sizes;	// constraints of every color, max_colors for the uncolored
+	std::vector<unsigned>			m_cursors;		// insertion point of every color in the counting sort
+	std::vector<ContactConstraint>	m_sorted;
+
+	// wide mode
+	std::vector<WideRow>		m_wide_rows;
+	std::vector<WideConstraint>	m_wide_constraints;
+	std::vector<unsigned>		m_wide_batches;		// first wide constraint of every color
 };
+
+
+/**
+* @brief split a range in tasks for the thread pool, or run it in this thread without one
+* @param count		size of the range
+* @param grain		indices per task
+* @param function	called with the begin and end of every task
+*/
+template <typename Function>
+void SolverConstraint::run( const unsigned count, const unsigned grain, Function function )
+{
+	if ( m_pool != nullptr )
+		m_pool->parallel_for( count, grain, function );
+	else
+		function( 0u, count );
+}
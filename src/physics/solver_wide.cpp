@@ -0,0 +1,230 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: solver_wide.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "solver.h"
+#include "rigid_body.h"
+
+#include <limits>
+
+
+/**
+* @brief copy a vec3 to a lane of the wide arrays
+*/
+static void set_lane( float ( &wide )[3][simd_width], const unsigned lane, const vec3& value )
+{
+	wide[0][lane] = value.x;
+	wide[1][lane] = value.y;
+	wide[2][lane] = value.z;
+}
+
+/**
+* @brief load the three components of a wide vector
+*/
+static WideVec3 load( const float ( &wide )[3][simd_width] )
+{
+	return { wide_load( wide[0] ), wide_load( wide[1] ), wide_load( wide[2] ) };
+}
+
+/**
+* @brief	transpose the constraints of every color to wide rows, simd_width constraints at a
+*			time. The constraints of a color do not share dynamic bodies, so the lanes are
+*			independent. Lanes without a row have no effective mass and never get an impulse
+*/
+void SolverConstraint::pack_wide()
+{
+	m_wide_constraints.clear();
+	m_wide_batches.assign( color_count() + 1u, 0u );
+
+	// groups of every color and their rows
+	unsigned row_count = 0u;
+	for ( unsigned color = 0u; color < color_count(); color++ )
+	{
+		m_wide_batches[color] = static_cast<unsigned>( m_wide_constraints.size() );
+
+		for ( unsigned first = m_batches[color]; first < m_batches[color + 1u]; first += simd_width )
+		{
+			WideConstraint wide;
+			wide.first_constraint = first;
+			wide.lane_count = glm::min( simd_width, m_batches[color + 1u] - first );
+			wide.first_row = row_count;
+			wide.normal_rows = 0u;
+
+			for ( unsigned lane = 0u; lane < wide.lane_count; lane++ )
+				wide.normal_rows = glm::max( wide.normal_rows, m_constraints[first + lane].point_count );
+
+			row_count += wide.normal_rows + 3u;
+			m_wide_constraints.push_back( wide );
+		}
+	}
+	m_wide_batches[color_count()] = static_cast<unsigned>( m_wide_constraints.size() );
+
+	// every lane of every row is written, so the old rows do not need to be cleared
+	m_wide_rows.resize( row_count );
+
+	static const ConstraintRow empty_row = {};	// static, so every member is zero
+
+	auto pack = [&]( const unsigned begin, const unsigned end )
+	{
+		for ( unsigned i = begin; i < end; i++ )
+		{
+			WideConstraint& wide = m_wide_constraints[i];
+
+			for ( unsigned lane = 0u; lane < simd_width; lane++ )
+			{
+				// the empty lanes read the first bodies and never write them
+				const bool empty = lane >= wide.lane_count;
+				const ContactConstraint& constraint = m_constraints[wide.first_constraint + ( empty ? 0u : lane )];
+
+				wide.body_A[lane] = constraint.body_A;
+				wide.body_B[lane] = constraint.body_B;
+				wide.friction[lane] = empty ? 0.0f : constraint.friction;
+				wide.inv_mass_A[lane] = empty ? 0.0f : m_bodies[constraint.body_A].inv_mass;
+				wide.inv_mass_B[lane] = empty ? 0.0f : m_bodies[constraint.body_B].inv_mass;
+
+				const unsigned point_count = empty ? 0u : constraint.point_count;
+
+				for ( unsigned wide_k = 0u; wide_k < wide.normal_rows + 3u; wide_k++ )
+				{
+					// the friction rows go after the normal rows of the widest lane
+					const ConstraintRow* row = &empty_row;
+					if ( wide_k < point_count )
+						row = &m_rows[constraint.first_row + wide_k];
+					else if ( empty == false && wide_k >= wide.normal_rows )
+						row = &m_rows[constraint.first_row + point_count + wide_k - wide.normal_rows];
+
+					WideRow& wide_row = m_wide_rows[wide.first_row + wide_k];
+
+					set_lane( wide_row.linear, lane, row->linear );
+					set_lane( wide_row.angular_A, lane, row->angular_A );
+					set_lane( wide_row.angular_B, lane, row->angular_B );
+					set_lane( wide_row.inv_I_angular_A, lane, row->inv_I_angular_A );
+					set_lane( wide_row.inv_I_angular_B, lane, row->inv_I_angular_B );
+					wide_row.effective_mass[lane] = row->effective_mass;
+					wide_row.bias[lane] = row->bias;
+					wide_row.impulse[lane] = row->impulse;
+				}
+			}
+		}
+	};
+
+	run( static_cast<unsigned>( m_wide_constraints.size() ), grain / simd_width, pack );
+}
+
+/**
+* @brief	one iteration of simd_width constraints, the velocities of the bodies are gathered
+*			once and kept in registers for every row
+* @param constraint
+*/
+void SolverConstraint::solve_wide( const WideConstraint& constraint )
+{
+	alignas( 32 ) float velocities[12][simd_width];
+
+	// gather
+	for ( unsigned lane = 0u; lane < simd_width; lane++ )
+	{
+		const SolverBody& a = m_bodies[constraint.body_A[lane]];
+		const SolverBody& b = m_bodies[constraint.body_B[lane]];
+
+		for ( unsigned c = 0u; c < 3u; c++ )
+		{
+			velocities[c][lane] = a.linear_velocity[c];
+			velocities[c + 3u][lane] = a.angular_velocity[c];
+			velocities[c + 6u][lane] = b.linear_velocity[c];
+			velocities[c + 9u][lane] = b.angular_velocity[c];
+		}
+	}
+
+	WideVec3 v_A = { wide_load( velocities[0] ), wide_load( velocities[1] ), wide_load( velocities[2] ) };
+	WideVec3 w_A = { wide_load( velocities[3] ), wide_load( velocities[4] ), wide_load( velocities[5] ) };
+	WideVec3 v_B = { wide_load( velocities[6] ), wide_load( velocities[7] ), wide_load( velocities[8] ) };
+	WideVec3 w_B = { wide_load( velocities[9] ), wide_load( velocities[10] ), wide_load( velocities[11] ) };
+
+	const WideFloat inv_mass_A = wide_load( constraint.inv_mass_A );
+	const WideFloat inv_mass_B = wide_load( constraint.inv_mass_B );
+
+	// same as solve_row with a range per lane
+	auto solve = [&]( WideRow& row, const WideFloat min_impulse, const WideFloat max_impulse )
+	{
+		const WideVec3 linear = load( row.linear );
+		const WideVec3 angular_A = load( row.angular_A );
+		const WideVec3 angular_B = load( row.angular_B );
+
+		const WideFloat Jv = wide_dot( linear, v_B - v_A ) + wide_dot( angular_B, w_B ) - wide_dot( angular_A, w_A );
+
+		const WideFloat old_impulse = wide_load( row.impulse );
+		const WideFloat impulse = wide_min( wide_max( old_impulse - wide_load( row.effective_mass ) * ( Jv + wide_load( row.bias ) ),
+													  min_impulse ), max_impulse );
+		wide_store( row.impulse, impulse );
+
+		const WideFloat delta = impulse - old_impulse;
+		v_A = v_A - linear * ( delta * inv_mass_A );
+		w_A = w_A - load( row.inv_I_angular_A ) * delta;
+		v_B = v_B + linear * ( delta * inv_mass_B );
+		w_B = w_B + load( row.inv_I_angular_B ) * delta;
+
+		return impulse;
+	};
+
+	WideRow* rows = m_wide_rows.data() + constraint.first_row;
+
+	// non penetration
+	const WideFloat zero = wide_set( 0.0f );
+	const WideFloat infinity = wide_set( std::numeric_limits<float>::max() );
+	WideFloat total_impulse = zero;
+	for ( unsigned k = 0u; k < constraint.normal_rows; k++ )
+		total_impulse = total_impulse + solve( rows[k], zero, infinity );
+
+	// friction and twist
+	const WideFloat friction = wide_load( constraint.friction ) * total_impulse;
+	for ( unsigned k = constraint.normal_rows; k < constraint.normal_rows + 3u; k++ )
+		solve( rows[k], -friction, friction );
+
+	// scatter, the static bodies are shared between lanes and never written
+	wide_store( velocities[0], v_A.x );		wide_store( velocities[1], v_A.y );		wide_store( velocities[2], v_A.z );
+	wide_store( velocities[3], w_A.x );		wide_store( velocities[4], w_A.y );		wide_store( velocities[5], w_A.z );
+	wide_store( velocities[6], v_B.x );		wide_store( velocities[7], v_B.y );		wide_store( velocities[8], v_B.z );
+	wide_store( velocities[9], w_B.x );		wide_store( velocities[10], w_B.y );	wide_store( velocities[11], w_B.z );
+
+	for ( unsigned lane = 0u; lane < constraint.lane_count; lane++ )
+	{
+		SolverBody& a = m_bodies[constraint.body_A[lane]];
+		SolverBody& b = m_bodies[constraint.body_B[lane]];
+
+		if ( a.inv_mass != 0.0f )
+		{
+			a.linear_velocity = vec3( velocities[0][lane], velocities[1][lane], velocities[2][lane] );
+			a.angular_velocity = vec3( velocities[3][lane], velocities[4][lane], velocities[5][lane] );
+		}
+		if ( b.inv_mass != 0.0f )
+		{
+			b.linear_velocity = vec3( velocities[6][lane], velocities[7][lane], velocities[8][lane] );
+			b.angular_velocity = vec3( velocities[9][lane], velocities[10][lane], velocities[11][lane] );
+		}
+	}
+}
+
+/**
+* @brief copy the impulses of the wide rows back to the constraint rows
+*/
+void SolverConstraint::unpack_wide()
+{
+	for ( const WideConstraint& wide : m_wide_constraints )
+	{
+		for ( unsigned lane = 0u; lane < wide.lane_count; lane++ )
+		{
+			const ContactConstraint& constraint = m_constraints[wide.first_constraint + lane];
+
+			for ( unsigned k = 0u; k < constraint.point_count + 3u; k++ )
+			{
+				const unsigned wide_k = k < constraint.point_count ? k : k - constraint.point_count + wide.normal_rows;
+				m_rows[constraint.first_row + k].impulse = m_wide_rows[wide.first_row + wide_k].impulse[lane];
+			}
+		}
+	}
+}
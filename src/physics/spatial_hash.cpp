@@ -0,0 +1,229 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: spatial_hash.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "spatial_hash.h"
+
+#include <algorithm>
+
+
+unsigned BroadphaseGrid::max_cells = 64u;
+
+/**
+* @brief rebuild the grid and find the bodies sharing cells O(n)
+* @param bodies
+*/
+void BroadphaseGrid::update( const std::vector<RigidBody>& bodies )
+{
+	m_pairs.clear();
+	m_pair_tests = 0u;
+
+	m_aabbs.resize( bodies.size() );
+	m_extents.resize( bodies.size() );
+
+	if ( bodies.size() < 2u )
+		return;
+
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		m_aabbs[i] = compute_aabb( bodies[i] );
+
+		const vec3 size = m_aabbs[i].max - m_aabbs[i].min;
+		m_extents[i] = glm::max( size.x, glm::max( size.y, size.z ) );
+	}
+
+	// the cell is as big as the median body, so most of them touch at most 8 cells
+	auto median = m_extents.begin() + m_extents.size() / 2u;
+	std::nth_element( m_extents.begin(), median, m_extents.end() );
+	m_cell_size = glm::max( *median, 0.0001f );
+
+	build_grid();
+	find_pairs();
+
+	// same order as the other broadphases
+	std::sort( m_pairs.begin(), m_pairs.end() );
+}
+
+/**
+* @brief clear the grid
+*/
+void BroadphaseGrid::clear()
+{
+	m_aabbs.clear();
+	m_large.clear();
+	m_bucket_start.clear();
+	m_entry_body.clear();
+	m_entry_cell.clear();
+	m_pairs.clear();
+	m_pair_tests = 0u;
+}
+
+/**
+* @brief get the size of the cells of the last update
+* @return cell size
+*/
+float BroadphaseGrid::cell_size() const
+{
+	return m_cell_size;
+}
+
+/**
+* @brief get the cell containing a point
+* @param point
+* @return cell coordinates
+*/
+ivec3 BroadphaseGrid::cell( const vec3& point ) const
+{
+	return ivec3( glm::floor( point / m_cell_size ) );
+}
+
+/**
+* @brief hash a cell to a bucket of the table
+* @param cell
+* @return bucket
+*/
+unsigned BroadphaseGrid::bucket( const ivec3& cell ) const
+{
+	const unsigned hash = static_cast<unsigned>( cell.x ) * 73856093u ^
+						  static_cast<unsigned>( cell.y ) * 19349663u ^
+						  static_cast<unsigned>( cell.z ) * 83492791u;
+	return hash & m_bucket_mask;
+}
+
+/**
+* @brief	store every body in the cells it touches, sorted by bucket with a counting sort
+*			so every bucket is a contiguous range of the entry arrays
+*/
+void BroadphaseGrid::build_grid()
+{
+	m_large.clear();
+
+	// count the entries
+	unsigned entry_count = 0u;
+	for ( unsigned i = 0u; i < m_aabbs.size(); i++ )
+	{
+		const ivec3 cells = cell( m_aabbs[i].max ) - cell( m_aabbs[i].min ) + ivec3( 1 );
+		const unsigned count = static_cast<unsigned>( cells.x * cells.y * cells.z );
+
+		if ( count > max_cells )
+			m_large.push_back( i );
+		else
+			entry_count += count;
+	}
+
+	// table with at least twice as many buckets as entries
+	unsigned bucket_count = 1u;
+	while ( bucket_count < entry_count * 2u )
+		bucket_count <<= 1u;
+
+	m_bucket_mask = bucket_count - 1u;
+	m_bucket_start.assign( bucket_count + 1u, 0u );
+	m_entry_body.resize( entry_count );
+	m_entry_cell.resize( entry_count );
+
+	// loop through the cells of the grid bodies
+	auto for_each_cell = [&]( auto function )
+	{
+		unsigned large = 0u;
+		for ( unsigned i = 0u; i < m_aabbs.size(); i++ )
+		{
+			if ( large < m_large.size() && m_large[large] == i )
+			{
+				large++;
+				continue;
+			}
+
+			const ivec3 min = cell( m_aabbs[i].min );
+			const ivec3 max = cell( m_aabbs[i].max );
+
+			for ( int x = min.x; x <= max.x; x++ )
+				for ( int y = min.y; y <= max.y; y++ )
+					for ( int z = min.z; z <= max.z; z++ )
+						function( i, ivec3( x, y, z ) );
+		}
+	};
+
+	// histogram of the buckets
+	for_each_cell( [&]( const unsigned, const ivec3& c )
+	{
+		m_bucket_start[bucket( c ) + 1u]++;
+	} );
+
+	// prefix sum gives the start of every bucket
+	for ( unsigned i = 1u; i <= bucket_count; i++ )
+		m_bucket_start[i] += m_bucket_start[i - 1u];
+
+	// scatter the entries, the start of each bucket is used as the insertion cursor
+	for_each_cell( [&]( const unsigned body, const ivec3& c )
+	{
+		const unsigned entry = m_bucket_start[bucket( c )]++;
+		m_entry_body[entry] = body;
+		m_entry_cell[entry] = c;
+	} );
+
+	// the cursors ended at the start of the next bucket, shift them back
+	for ( unsigned i = bucket_count; i > 0u; i-- )
+		m_bucket_start[i] = m_bucket_start[i - 1u];
+	m_bucket_start[0u] = 0u;
+}
+
+/**
+* @brief test the bodies sharing a cell, and the large bodies against everything
+*/
+void BroadphaseGrid::find_pairs()
+{
+	const unsigned bucket_count = m_bucket_mask + 1u;
+
+	for ( unsigned b = 0u; b < bucket_count; b++ )
+	{
+		const unsigned begin = m_bucket_start[b];
+		const unsigned end = m_bucket_start[b + 1u];
+
+		for ( unsigned i = begin; i < end; i++ )
+		{
+			for ( unsigned j = i + 1u; j < end; j++ )
+			{
+				// different cells in the same bucket
+				if ( m_entry_cell[i] != m_entry_cell[j] )
+					continue;
+
+				const AABB& a = m_aabbs[m_entry_body[i]];
+				const AABB& c = m_aabbs[m_entry_body[j]];
+
+				m_pair_tests++;
+				if ( overlap_aabb( a, c ) == false )
+					continue;
+
+				// the pair is only reported by the cell containing the minimum corner of the overlap
+				if ( cell( glm::max( a.min, c.min ) ) != m_entry_cell[i] )
+					continue;
+
+				const unsigned body_A = m_entry_body[i];
+				const unsigned body_B = m_entry_body[j];
+				m_pairs.push_back( BodyPair{ glm::min( body_A, body_B ), glm::max( body_A, body_B ) } );
+			}
+		}
+	}
+
+	// large bodies against every other body
+	for ( unsigned i = 0u; i < m_large.size(); i++ )
+	{
+		const unsigned large = m_large[i];
+
+		for ( unsigned body = 0u; body < m_aabbs.size(); body++ )
+		{
+			// pairs of large bodies are tested only once
+			if ( body == large || ( body > large && std::binary_search( m_large.begin(), m_large.end(), body ) ) )
+				continue;
+
+			m_pair_tests++;
+			if ( overlap_aabb( m_aabbs[large], m_aabbs[body] ) )
+				m_pairs.push_back( BodyPair{ glm::min( large, body ), glm::max( large, body ) } );
+		}
+	}
+}
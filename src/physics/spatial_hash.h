@@ -0,0 +1,45 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: spatial_hash.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "broadphase.h"
+
+#include <vector>
+
+class BroadphaseGrid : public Broadphase
+{
+public:
+	void update( const std::vector<RigidBody>& bodies ) final;
+	void clear() final;
+
+	float cell_size() const;
+
+public:
+	static unsigned max_cells;	// bodies covering more cells are tested against every body
+
+private:
+	ivec3		cell		( const vec3& point ) const;
+	unsigned	bucket		( const ivec3& cell ) const;
+	void		build_grid	();
+	void		find_pairs	();
+
+private:
+	float		m_cell_size{ 1.0f };
+	unsigned	m_bucket_mask{ 0u };
+
+	std::vector<AABB>		m_aabbs;		// bounding box of each body
+	std::vector<float>		m_extents;		// scratch to find the median size
+	std::vector<unsigned>	m_large;		// bodies that are not stored in the grid
+
+	// counting sort layout: the entries of bucket i are [m_bucket_start[i], m_bucket_start[i + 1])
+	std::vector<unsigned>	m_bucket_start;
+	std::vector<unsigned>	m_entry_body;
+	std::vector<ivec3>		m_entry_cell;
+};
@@ -0,0 +1,424 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sphere_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "sphere_collision.h"
+#include "profiler.h"
+
+#include <limits>
+#include <utility>
+
+std::pair<vec3, vec3> closest_points_segment( const vec3& a0, const vec3& a1, const vec3& b0, const vec3& b1 );
+
+/**
+* @brief parameter of the closest point of a segment to a point
+* @param point
+* @param start
+* @param end
+* @return from 0 at the start to 1 at the end
+*/
+static float closest_parameter( const vec3& point, const vec3& start, const vec3& end )
+{
+	const vec3 segment = end - start;
+	const float length2 = dot( segment, segment );
+	if ( length2 <= 1e-12f )
+		return 0.0f;
+
+	return glm::clamp( dot( point - start, segment ) / length2, 0.0f, 1.0f );
+}
+
+/**
+* @brief	get the sphere of a body, from the largest extent of its mesh since a tessellated
+*			sphere may not reach it in every axis. The radius is scaled with x
+* @param body
+* @param transform	transformation of the body from the cache of the step
+* @return sphere as a capsule without segment
+*/
+Capsule make_sphere( const RigidBody& body, const BodyTransform& transform )
+{
+	const vec3 extents = ( body.mesh->bounds_max() - body.mesh->bounds_min() ) * 0.5f;
+	const float radius = glm::max( glm::max( extents.x, extents.y ), extents.z ) * std::abs( body.scl.x );
+	return Capsule{ transform.model.translation, transform.model.translation, radius };
+}
+
+/**
+* @brief	get the capsule of a body, from the bounds of its mesh. The radius is scaled with x
+*			and the length with y
+* @param body
+* @param transform	transformation of the body from the cache of the step
+* @return capsule
+*/
+Capsule make_capsule( const RigidBody& body, const BodyTransform& transform )
+{
+	const vec3 extents = ( body.mesh->bounds_max() - body.mesh->bounds_min() ) * 0.5f;
+	const float radius = extents.x * std::abs( body.scl.x );
+	const float half_height = glm::max( extents.y * std::abs( body.scl.y ) - radius, 0.0f );
+
+	// the y column of the model is the axis scaled
+	const vec3 axis = transform.model.linear[1] / body.scl.y * half_height;
+	const vec3& center = transform.model.translation;
+	return Capsule{ center - axis, center + axis, radius };
+}
+
+/**
+* @brief prepare the surface queries of a body
+* @param body
+* @param transform	transformation of the body from the cache of the step
+* @return query
+*/
+ShapeQuery make_shape_query( const RigidBody& body, const BodyTransform& transform )
+{
+	ShapeQuery query;
+	query.shape = body.shape;
+	query.mesh = body.mesh;
+
+	switch ( body.shape )
+	{
+	case ShapeType::Box:
+		query.box = make_box( body, transform );
+		break;
+	case ShapeType::Sphere:
+		query.capsule = make_sphere( body, transform );
+		break;
+	case ShapeType::Capsule:
+		query.capsule = make_capsule( body, transform );
+		break;
+	case ShapeType::Hull:
+		query.model = transform.model;
+		query.normal_matrix = transpose( transform.inverse.linear );
+		break;
+	}
+
+	return query;
+}
+
+/**
+* @brief closest point of the surface of a box, pushed out through the closest face from inside
+*/
+static SurfacePoint box_surface_point( const Box& box, const vec3& point )
+{
+	const vec3 d = point - box.center;
+	const vec3 local = vec3( dot( d, box.axes[0] ), dot( d, box.axes[1] ), dot( d, box.axes[2] ) );
+	const vec3 clamped = glm::clamp( local, -box.half_extents, box.half_extents );
+
+	SurfacePoint surface;
+
+	// outside, the clamped point is the closest
+	if ( clamped != local )
+	{
+		surface.point = box.center + box.axes[0] * clamped.x + box.axes[1] * clamped.y + box.axes[2] * clamped.z;
+		surface.distance = glm::length( point - surface.point );
+		surface.normal = ( point - surface.point ) / surface.distance;
+		return surface;
+	}
+
+	// inside, the face with the least penetration
+	unsigned axis = 0u;
+	float min_penetration = std::numeric_limits<float>::max();
+	for ( unsigned i = 0u; i < 3u; i++ )
+	{
+		const float penetration = box.half_extents[i] - std::abs( local[i] );
+		if ( penetration < min_penetration )
+		{
+			min_penetration = penetration;
+			axis = i;
+		}
+	}
+
+	surface.normal = box.axes[axis] * ( local[axis] < 0.0f ? -1.0f : 1.0f );
+	surface.distance = -min_penetration;
+	surface.point = point + surface.normal * min_penetration;
+	return surface;
+}
+
+/**
+* @brief	closest point of the surface of a hull, the closest of the faces in front of the point
+*			or the least penetrating face from inside
+*/
+static SurfacePoint hull_surface_point( const ShapeQuery& query, const vec3& point )
+{
+	const std::vector<FlatFace>& faces = query.mesh->flat_faces();
+	const std::vector<unsigned>& face_vertices = query.mesh->face_vertices();
+	const auto& vertices = query.mesh->vertices();
+
+	// the face with the largest distance to the point
+	unsigned best_face = 0u;
+	float max_distance = -std::numeric_limits<float>::max();
+	for ( unsigned i = 0u; i < faces.size(); i++ )
+	{
+		const vec3 normal = normalize( query.normal_matrix * faces[i].normal );
+		const vec3 vertex = query.model.point( vertices[face_vertices[faces[i].first_vertex]] );
+		const float distance = dot( normal, point - vertex );
+		if ( distance > max_distance )
+		{
+			max_distance = distance;
+			best_face = i;
+		}
+	}
+
+	SurfacePoint surface;
+
+	// inside, pushed out through that face
+	if ( max_distance <= 0.0f )
+	{
+		surface.normal = normalize( query.normal_matrix * faces[best_face].normal );
+		surface.distance = max_distance;
+		surface.point = point - surface.normal * max_distance;
+		return surface;
+	}
+
+	// outside, the closest point of the faces that see the point
+	surface.distance = std::numeric_limits<float>::max();
+	for ( const FlatFace& face : faces )
+	{
+		const unsigned* polygon = &face_vertices[face.first_vertex];
+
+		const vec3 normal = normalize( query.normal_matrix * face.normal );
+		const vec3 origin = query.model.point( vertices[polygon[0u]] );
+		const float distance = dot( normal, point - origin );
+		if ( distance <= 0.0f )
+			continue;
+
+		// the projection on the plane if it is inside the polygon, otherwise the closest of its edges
+		const vec3 projection = point - normal * distance;
+		vec3 closest = projection;
+		bool inside = true;
+		float closest_distance2 = std::numeric_limits<float>::max();
+
+		const unsigned size = face.vertex_count;
+		vec3 a = query.model.point( vertices[polygon[size - 1u]] );
+		for ( unsigned i = 0u; i < size; i++ )
+		{
+			const vec3 b = query.model.point( vertices[polygon[i]] );
+			if ( dot( cross( b - a, projection - a ), normal ) < 0.0f )
+			{
+				inside = false;
+				const vec3 candidate = a + ( b - a ) * closest_parameter( point, a, b );
+				const float distance2 = glm::length2( point - candidate );
+				if ( distance2 < closest_distance2 )
+				{
+					closest_distance2 = distance2;
+					closest = candidate;
+				}
+			}
+			a = b;
+		}
+
+		const float face_distance = inside ? distance : std::sqrt( closest_distance2 );
+		if ( face_distance < surface.distance )
+		{
+			surface.distance = face_distance;
+			surface.point = closest;
+		}
+	}
+
+	surface.normal = surface.distance > 0.0f ? ( point - surface.point ) / surface.distance : normalize( query.normal_matrix * faces[best_face].normal );
+	return surface;
+}
+
+/**
+* @brief closest point of the surface of a sphere or a capsule, around the closest point of its segment
+*/
+static SurfacePoint round_surface_point( const Capsule& capsule, const vec3& point )
+{
+	const vec3 center = capsule.start + ( capsule.end - capsule.start ) * closest_parameter( point, capsule.start, capsule.end );
+	const float length = glm::length( point - center );
+
+	SurfacePoint surface;
+	surface.normal = length > 1e-6f ? ( point - center ) / length : vec3( 0.0f, 1.0f, 0.0f );
+	surface.distance = length - capsule.radius;
+	surface.point = center + surface.normal * capsule.radius;
+	return surface;
+}
+
+/**
+* @brief find the closest point of the surface of a body
+* @param query	body
+* @param point
+* @return closest point and signed distance
+*/
+SurfacePoint surface_point( const ShapeQuery& query, const vec3& point )
+{
+	switch ( query.shape )
+	{
+	case ShapeType::Box:
+		return box_surface_point( query.box, point );
+	case ShapeType::Sphere:
+	case ShapeType::Capsule:
+		return round_surface_point( query.capsule, point );
+	default:
+		return hull_surface_point( query, point );
+	}
+}
+
+/**
+* @brief	parameter of the point of a segment closest to a body. Closed form for spheres and
+*			capsules, a golden section search otherwise since the signed distance to a convex
+*			body is a convex function along the segment
+* @param query	body
+* @param start
+* @param end
+* @return from 0 at the start to 1 at the end
+*/
+static float closest_parameter( const ShapeQuery& query, const vec3& start, const vec3& end )
+{
+	if ( query.shape == ShapeType::Sphere || query.shape == ShapeType::Capsule )
+	{
+		const auto points = closest_points_segment( start, end, query.capsule.start, query.capsule.end );
+		return closest_parameter( points.first, start, end );
+	}
+
+	const unsigned iterations = 20u;
+	const float ratio = 0.618034f;
+
+	auto distance = [&]( const float t ) { return surface_point( query, start + ( end - start ) * t ).distance; };
+
+	float a = 0.0f;
+	float b = 1.0f;
+	float c = b - ratio * ( b - a );
+	float d = a + ratio * ( b - a );
+	float distance_c = distance( c );
+	float distance_d = distance( d );
+	for ( unsigned i = 0u; i < iterations; i++ )
+	{
+		if ( distance_c < distance_d )
+		{
+			b = d;
+			d = c;
+			distance_d = distance_c;
+			c = b - ratio * ( b - a );
+			distance_c = distance( c );
+		}
+		else
+		{
+			a = c;
+			c = d;
+			distance_c = distance_d;
+			d = a + ratio * ( b - a );
+			distance_d = distance( d );
+		}
+	}
+
+	return ( a + b ) * 0.5f;
+}
+
+/**
+* @brief contact point of a sphere at a point against the surface of a body
+*/
+static ContactPoint round_contact_point( const SurfacePoint& surface, const vec3& center, const float radius, const unsigned feature )
+{
+	return ContactPoint{ surface.point, center - surface.normal * radius, radius - surface.distance, 0.0f, 0.0f, feature };
+}
+
+/**
+* @brief	collision of a sphere with any body, the closest point of the body to its center
+* @param sphere
+* @param other
+* @param contact_data	return manifold, from the other body to the sphere
+* @return the bodies are colliding
+*/
+bool overlap_sphere( RigidBody& sphere, RigidBody& other, ContactManifold& contact_data )
+{
+	return overlap_sphere( sphere, other, contact_data, make_body_transform( sphere ), make_body_transform( other ) );
+}
+
+/**
+* @brief collision of a sphere with any body
+* @param sphere
+* @param other
+* @param contact_data		return manifold, from the other body to the sphere
+* @param sphere_transform	transformation of the sphere from the cache of the step
+* @param other_transform	transformation of the other body from the cache of the step
+* @return the bodies are colliding
+*/
+bool overlap_sphere( RigidBody& sphere, RigidBody& other, ContactManifold& contact_data, const BodyTransform& sphere_transform, const BodyTransform& other_transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Shapes );
+
+	const Capsule shape = make_sphere( sphere, sphere_transform );
+	const SurfacePoint surface = surface_point( make_shape_query( other, other_transform ), shape.start );
+	if ( surface.distance > shape.radius )
+		return false;
+
+	contact_data = ContactManifold();
+	contact_data.normal = surface.normal;
+	contact_data.points.push_back( round_contact_point( surface, shape.start, shape.radius, 0u ) );
+	contact_data.body_A = &other;
+	contact_data.body_B = &sphere;
+
+	return true;
+}
+
+/**
+* @brief	collision of a capsule with any body. The point of its segment closest to the body
+*			makes the contact, or both ends when they touch the body along the same normal, so a
+*			lying capsule rests on two points
+* @param capsule
+* @param other
+* @param contact_data	return manifold, from the other body to the capsule
+* @return the bodies are colliding
+*/
+bool overlap_capsule( RigidBody& capsule, RigidBody& other, ContactManifold& contact_data )
+{
+	return overlap_capsule( capsule, other, contact_data, make_body_transform( capsule ), make_body_transform( other ) );
+}
+
+/**
+* @brief collision of a capsule with any body
+* @param capsule
+* @param other
+* @param contact_data		return manifold, from the other body to the capsule
+* @param capsule_transform	transformation of the capsule from the cache of the step
+* @param other_transform	transformation of the other body from the cache of the step
+* @return the bodies are colliding
+*/
+bool overlap_capsule( RigidBody& capsule, RigidBody& other, ContactManifold& contact_data, const BodyTransform& capsule_transform, const BodyTransform& other_transform )
+{
+	PROFILE_SCOPE( ProfilePhase::Shapes );
+
+	// ends closer than this to the closest point do not add another point
+	const float distinct = 1e-3f;
+
+	// ends whose normal is further than this from the closest one are not added
+	const float min_alignment = 0.9f;
+
+	const Capsule shape = make_capsule( capsule, capsule_transform );
+	const ShapeQuery query = make_shape_query( other, other_transform );
+
+	const float t = closest_parameter( query, shape.start, shape.end );
+	const vec3 closest = shape.start + ( shape.end - shape.start ) * t;
+	const SurfacePoint surface = surface_point( query, closest );
+	if ( surface.distance > shape.radius )
+		return false;
+
+	contact_data = ContactManifold();
+	contact_data.normal = surface.normal;
+
+	// the ends, identified by their side of the segment
+	const float length = glm::length( shape.end - shape.start );
+	const float ends[2] = { 0.0f, 1.0f };
+	for ( unsigned i = 0u; i < 2u; i++ )
+	{
+		if ( std::abs( ends[i] - t ) * length < distinct )
+			continue;
+
+		const vec3 center = i == 0u ? shape.start : shape.end;
+		const SurfacePoint end_surface = surface_point( query, center );
+		if ( end_surface.distance <= shape.radius && dot( end_surface.normal, surface.normal ) > min_alignment )
+			contact_data.points.push_back( round_contact_point( end_surface, center, shape.radius, i + 1u ) );
+	}
+
+	// both ends touching already support the capsule
+	if ( contact_data.points.size() < 2u )
+		contact_data.points.push_back( round_contact_point( surface, closest, shape.radius, 0u ) );
+
+	contact_data.body_A = &other;
+	contact_data.body_B = &capsule;
+
+	return true;
+}
@@ -0,0 +1,55 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sphere_collision.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "rigid_body.h"
+#include "contact.h"
+#include "box_collision.h"
+#include "transform.h"
+
+#include "math_utils.h"
+
+// sphere swept along a segment in world space, a sphere has a null segment
+struct Capsule
+{
+	vec3	start;
+	vec3	end;
+	float	radius;
+};
+
+// closest point of the surface of a body to a point
+struct SurfacePoint
+{
+	vec3	point;
+	vec3	normal;		// out of the body
+	float	distance;	// from the surface to the point, negative inside the body
+};
+
+// what the surface queries need of a body, computed once per pair
+struct ShapeQuery
+{
+	ShapeType			shape;
+	Box					box;
+	Capsule				capsule;		// sphere and capsule
+	const HalfEdgeMesh*	mesh;			// hull
+	Transform			model;
+	mat3				normal_matrix;
+};
+
+Capsule make_sphere	( const RigidBody& body, const BodyTransform& transform );
+Capsule make_capsule( const RigidBody& body, const BodyTransform& transform );
+
+ShapeQuery	 make_shape_query( const RigidBody& body, const BodyTransform& transform );
+SurfacePoint surface_point	 ( const ShapeQuery& query, const vec3& point );
+
+bool overlap_sphere ( RigidBody& sphere, RigidBody& other, ContactManifold& contact_data );
+bool overlap_sphere ( RigidBody& sphere, RigidBody& other, ContactManifold& contact_data, const BodyTransform& sphere_transform, const BodyTransform& other_transform );
+bool overlap_capsule( RigidBody& capsule, RigidBody& other, ContactManifold& contact_data );
+bool overlap_capsule( RigidBody& capsule, RigidBody& other, ContactManifold& contact_data, const BodyTransform& capsule_transform, const BodyTransform& other_transform );
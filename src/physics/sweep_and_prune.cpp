@@ -0,0 +1,165 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sweep_and_prune.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "sweep_and_prune.h"
+
+#include <algorithm>
+#include <iterator>
+
+/**
+* @brief endpoints are sorted by value, with the minimums first on ties so touching boxes overlap
+*/
+static bool is_greater( const SapEndpoint& a, const SapEndpoint& b )
+{
+	return a.value > b.value || ( a.value == b.value && a.is_max && b.is_max == false );
+}
+
+/**
+* @brief refresh the endpoints and sort them again, pairs are added and removed as the endpoints swap
+* @param bodies
+*/
+void BroadphaseSAP::update( const std::vector<RigidBody>& bodies )
+{
+	// bodies were removed, start over
+	if ( bodies.size() < m_aabbs.size() )
+		clear();
+
+	m_swapped.clear();
+	m_added.clear();
+	m_removed.clear();
+	m_pair_tests = 0u;
+
+	const unsigned old_count = static_cast<unsigned>( m_aabbs.size() );
+
+	// new bounding boxes
+	m_aabbs.resize( bodies.size() );
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+		m_aabbs[i] = compute_aabb( bodies[i] );
+
+	for ( unsigned axis = 0u; axis < 3u; axis++ )
+	{
+		auto& endpoints = m_endpoints[axis];
+
+		// new bodies start at the end, the sort moves them to their place
+		for ( unsigned i = old_count; i < bodies.size(); i++ )
+		{
+			endpoints.push_back( SapEndpoint{ 0.0f, i, false } );
+			endpoints.push_back( SapEndpoint{ 0.0f, i, true } );
+		}
+
+		for ( SapEndpoint& endpoint : endpoints )
+			endpoint.value = endpoint.is_max ? m_aabbs[endpoint.body].max[axis] : m_aabbs[endpoint.body].min[axis];
+
+		sort_axis( axis );
+	}
+
+	update_overlaps();
+
+	// candidate pairs, already in the same order as the other broadphases
+	m_pairs = m_overlaps;
+}
+
+/**
+* @brief remove every body
+*/
+void BroadphaseSAP::clear()
+{
+	for ( auto& endpoints : m_endpoints )
+		endpoints.clear();
+
+	m_aabbs.clear();
+	m_overlaps.clear();
+	m_swapped.clear();
+	m_kept.clear();
+	m_added.clear();
+	m_removed.clear();
+	m_pairs.clear();
+	m_pair_tests = 0u;
+}
+
+/**
+* @brief get the pairs that started overlapping in the last update
+* @return pairs
+*/
+const std::vector<BodyPair>& BroadphaseSAP::added_pairs() const
+{
+	return m_added;
+}
+
+/**
+* @brief get the pairs that stopped overlapping in the last update
+* @return pairs
+*/
+const std::vector<BodyPair>& BroadphaseSAP::removed_pairs() const
+{
+	return m_removed;
+}
+
+/**
+* @brief	insertion sort of the endpoints of an axis, almost O(n) when the bodies move little
+*			between updates
+* @param axis
+*/
+void BroadphaseSAP::sort_axis( const unsigned axis )
+{
+	auto& endpoints = m_endpoints[axis];
+
+	for ( unsigned j = 1u; j < endpoints.size(); j++ )
+	{
+		const SapEndpoint key = endpoints[j];
+
+		int i = static_cast<int>( j ) - 1;
+		while ( i >= 0 && is_greater( endpoints[i], key ) )
+		{
+			const SapEndpoint& swapped = endpoints[i];
+
+			// a minimum passes a maximum the boxes may start overlapping, a maximum passes a minimum
+			// they stop, the pair is checked once all the axes are sorted
+			if ( key.is_max != swapped.is_max )
+				m_swapped.push_back( BodyPair{ glm::min( key.body, swapped.body ), glm::max( key.body, swapped.body ) } );
+
+			endpoints[i + 1] = endpoints[i];
+			i--;
+		}
+
+		endpoints[i + 1] = key;
+	}
+}
+
+/**
+* @brief	compare the pairs whose endpoints swapped with the overlaps of the last update, and
+*			apply the changes to the sorted overlaps with a merge, O(k log k + n)
+*/
+void BroadphaseSAP::update_overlaps()
+{
+	std::sort( m_swapped.begin(), m_swapped.end() );
+	m_swapped.erase( std::unique( m_swapped.begin(), m_swapped.end() ), m_swapped.end() );
+
+	// the events of a pair may cancel each other, only its state before and after counts
+	for ( const BodyPair& pair : m_swapped )
+	{
+		m_pair_tests++;
+		const bool overlapping = overlap_aabb( m_aabbs[pair.body_A], m_aabbs[pair.body_B] );
+		const bool was_overlapping = std::binary_search( m_overlaps.begin(), m_overlaps.end(), pair );
+
+		if ( overlapping && was_overlapping == false )
+			m_added.push_back( pair );
+		else if ( overlapping == false && was_overlapping )
+			m_removed.push_back( pair );
+	}
+
+	if ( m_added.empty() && m_removed.empty() )
+		return;
+
+	m_kept.clear();
+	std::set_difference( m_overlaps.begin(), m_overlaps.end(), m_removed.begin(), m_removed.end(), std::back_inserter( m_kept ) );
+
+	m_overlaps.clear();
+	std::merge( m_kept.begin(), m_kept.end(), m_added.begin(), m_added.end(), std::back_inserter( m_overlaps ) );
+}
@@ -0,0 +1,51 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: sweep_and_prune.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "broadphase.h"
+
+#include <vector>
+
+struct SapEndpoint
+{
+	float		value;
+	unsigned	body;
+	bool		is_max;
+};
+
+class BroadphaseSAP : public Broadphase
+{
+public:
+	void update( const std::vector<RigidBody>& bodies ) final;
+	void clear() final;
+
+	const std::vector<BodyPair>& added_pairs	() const;
+	const std::vector<BodyPair>& removed_pairs	() const;
+
+private:
+	void sort_axis		( const unsigned axis );
+	void update_overlaps();
+
+private:
+	std::vector<SapEndpoint>	m_endpoints[3];	// sorted min and max values of each axis (kept between updates)
+	std::vector<AABB>			m_aabbs;		// bounding box of each body in the current update
+
+	// overlapping pairs sorted by body, kept between updates
+	std::vector<BodyPair> m_overlaps;
+
+	// pairs whose endpoints swapped in the current update, and the overlaps without the removed
+	// pairs, both reused by every update
+	std::vector<BodyPair> m_swapped;
+	std::vector<BodyPair> m_kept;
+
+	// changes of the last update, sorted
+	std::vector<BodyPair> m_added;
+	std::vector<BodyPair> m_removed;
+};
@@ -0,0 +1,91 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: transform.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include "transform.h"
+#include "rigid_body.h"
+
+
+/**
+* @brief get the 4x4 matrix of the transformation, for rendering
+* @return matrix
+*/
+mat4 Transform::matrix() const
+{
+	mat4 matrix( linear );
+	matrix[3] = vec4( translation, 1.0f );
+	return matrix;
+}
+
+/**
+* @brief	build the model to world transformation of a pose, the inverse undoes the translation,
+*			rotation and scale in order instead of inverting a general matrix
+* @param position
+* @param rotation
+* @param scale
+* @return transformation and its inverse
+*/
+BodyTransform make_body_transform( const vec3& position, const quat& rotation, const vec3& scale )
+{
+	const mat3 rotation_matrix = glm::mat3_cast( rotation );
+	const mat3 inverse_rotation = transpose( rotation_matrix );
+
+	BodyTransform transform;
+	transform.model.linear = mat3( rotation_matrix[0] * scale.x, rotation_matrix[1] * scale.y, rotation_matrix[2] * scale.z );
+	transform.model.translation = position;
+
+	// the rows of the inverse rotation divided by the scale
+	const vec3 inverse_scale = 1.0f / scale;
+	for ( unsigned i = 0u; i < 3u; i++ )
+		transform.inverse.linear[i] = inverse_rotation[i] * inverse_scale;
+	transform.inverse.translation = -( transform.inverse.linear * position );
+
+	return transform;
+}
+
+/**
+* @brief build the model to world transformation of a body
+* @param body
+* @return transformation and its inverse
+*/
+BodyTransform make_body_transform( const RigidBody& body )
+{
+	return make_body_transform( body.position, body.rot, body.scl );
+}
+
+/**
+* @brief relative transformations of two bodies
+* @param body_A
+* @param body_B
+* @return transformations of the pair
+*/
+PairTransform make_pair_transform( const BodyTransform& body_A, const BodyTransform& body_B )
+{
+	return PairTransform{ body_A.model, body_B.model, body_B.inverse * body_A.model, body_A.inverse * body_B.model };
+}
+
+/**
+* @brief relative transformations of two bodies, from their current pose
+* @param body_A
+* @param body_B
+* @return transformations of the pair
+*/
+PairTransform make_pair_transform( const RigidBody& body_A, const RigidBody& body_B )
+{
+	return make_pair_transform( make_body_transform( body_A ), make_body_transform( body_B ) );
+}
+
+/**
+* @brief transformations of the same pair with the bodies swapped
+* @param transform
+* @return transformations of B and A
+*/
+PairTransform swap_pair_transform( const PairTransform& transform )
+{
+	return PairTransform{ transform.model_B, transform.model_A, transform.B_to_A, transform.A_to_B };
+}
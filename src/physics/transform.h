@@ -0,0 +1,60 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: transform.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "math_utils.h"
+
+struct RigidBody;
+
+// affine transformation as its linear part and translation (3x4), the last row of a model
+// matrix is always 0 0 0 1
+struct Transform
+{
+	mat3 linear{ 1.0f };
+	vec3 translation{ 0.0f, 0.0f, 0.0f };
+
+	vec3 point ( const vec3& point )  const { return linear * point + translation; }
+	vec3 vector( const vec3& vector ) const { return linear * vector; }
+	mat4 matrix() const;
+};
+
+/**
+* @brief compose two transformations, b is applied first
+* @param a
+* @param b
+* @return a * b
+*/
+inline Transform operator*( const Transform& a, const Transform& b )
+{
+	return Transform{ a.linear * b.linear, a.linear * b.translation + a.translation };
+}
+
+// model to world transformation of a body and its inverse
+struct BodyTransform
+{
+	Transform model;
+	Transform inverse;
+};
+
+// transformations of a pair of bodies for the narrowphase
+struct PairTransform
+{
+	Transform model_A;
+	Transform model_B;
+	Transform A_to_B;	// from the model space of A to the model space of B
+	Transform B_to_A;
+};
+
+BodyTransform make_body_transform( const vec3& position, const quat& rotation, const vec3& scale );
+BodyTransform make_body_transform( const RigidBody& body );
+
+PairTransform make_pair_transform( const BodyTransform& body_A, const BodyTransform& body_B );
+PairTransform make_pair_transform( const RigidBody& body_A, const RigidBody& body_B );
+PairTransform swap_pair_transform( const PairTransform& transform );
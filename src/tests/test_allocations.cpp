@@ -0,0 +1,203 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_allocations.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "physics.h"
+#include "sweep_and_prune.h"
+#include "test_helpers.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// allocations of every thread while counting, also the workers of the thread pool. Every new of
+// the test binary goes through here
+static std::atomic<bool>		counting{ false };
+static std::atomic<unsigned>	allocations{ 0u };
+
+/**
+* @brief count and allocate memory
+*/
+static void* allocate( const std::size_t size )
+{
+	if ( counting == true )
+		allocations++;
+
+	void* memory = std::malloc( size == 0u ? 1u : size );
+	if ( memory == nullptr )
+		throw std::bad_alloc();
+	return memory;
+}
+
+/**
+* @brief count and allocate aligned memory
+*/
+static void* allocate( const std::size_t size, const std::align_val_t alignment )
+{
+	if ( counting == true )
+		allocations++;
+
+	const std::size_t align = static_cast<std::size_t>( alignment );
+	void* memory = std::aligned_alloc( align, ( size + align - 1u ) / align * align );
+	if ( memory == nullptr )
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new	( std::size_t size )								{ return allocate( size ); }
+void* operator new[]( std::size_t size )								{ return allocate( size ); }
+void* operator new	( std::size_t size, std::align_val_t alignment )	{ return allocate( size, alignment ); }
+void* operator new[]( std::size_t size, std::align_val_t alignment )	{ return allocate( size, alignment ); }
+
+void operator delete	( void* memory ) noexcept								{ std::free( memory ); }
+void operator delete[]	( void* memory ) noexcept								{ std::free( memory ); }
+void operator delete	( void* memory, std::size_t ) noexcept					{ std::free( memory ); }
+void operator delete[]	( void* memory, std::size_t ) noexcept					{ std::free( memory ); }
+void operator delete	( void* memory, std::align_val_t ) noexcept				{ std::free( memory ); }
+void operator delete[]	( void* memory, std::align_val_t ) noexcept				{ std::free( memory ); }
+void operator delete	( void* memory, std::size_t, std::align_val_t ) noexcept	{ std::free( memory ); }
+void operator delete[]	( void* memory, std::size_t, std::align_val_t ) noexcept	{ std::free( memory ); }
+
+/**
+* @brief add a resting body of a mesh of the physics
+*/
+static void add_body( const unsigned mesh, const ShapeType shape, const vec3& position, const vec3& scale, const float mass )
+{
+	Physics& physics = Physics::get_instance();
+
+	RigidBody body;
+	body.mesh = physics.meshes()[mesh];
+	body.shape = shape;
+	body.position = position;
+	body.scl = scale;
+	body.mass = mass;
+	body.set_inertia( body.mesh->compute_intertia_tensor() * mass );
+	physics.add_body( body );
+}
+
+TEST( allocations, resting_bodies_step_without_allocating )
+{
+	Physics& physics = Physics::get_instance();
+	physics.initialize( load_meshes() );
+	physics.set_sleeping( false );
+
+	// a task per constraint, so the workers of the thread pool solve the few contacts too
+	const unsigned grain = SolverConstraint::grain;
+	SolverConstraint::grain = 1u;
+
+	// after the caches and scratch buffers have grown, with every solver mode, with the shape
+	// routines and with the generic queries of sat and gjk
+	for ( const SolverMode mode : { SolverMode::Sequential, SolverMode::Colored, SolverMode::Wide } )
+	{
+		physics.set_solver_mode( mode );
+
+		// boxes, hulls and a capsule resting on a floor and on each other, awake every step. The
+		// bodies have no friction and slowly slide apart, every mode starts again
+		physics.clear();
+		add_body( 0u, ShapeType::Box, vec3( 0.0f, -0.5f, 0.0f ), vec3( 20.0f, 1.0f, 20.0f ), 0.0f );
+		add_body( 0u, ShapeType::Box, vec3( 0.0f, 0.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 0u, ShapeType::Box, vec3( 0.0f, 1.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 0u, ShapeType::Hull, vec3( 2.0f, 0.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 1u, ShapeType::Hull, vec3( 5.0f, 2.0f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 0u, ShapeType::Hull, vec3( 5.0f, 4.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 2u, ShapeType::Hull, vec3( -3.0f, 1.0f, 0.0f ), vec3( 1.0f ), 1.0f );
+		add_body( 5u, ShapeType::Capsule, vec3( -6.0f, 1.0f, 0.0f ), vec3( 1.0f ), 1.0f );
+
+		for ( const NarrowphaseType type : { NarrowphaseType::Auto, NarrowphaseType::Sat, NarrowphaseType::Gjk } )
+		{
+			physics.set_narrowphase( type );
+			physics.set_shape_routines( type == NarrowphaseType::Auto );
+
+			for ( unsigned i = 0u; i < 300u; i++ )
+				physics.update( 1.0f / 60.0f );
+
+			allocations = 0u;
+			counting = true;
+			for ( unsigned i = 0u; i < 60u; i++ )
+				physics.update( 1.0f / 60.0f );
+			counting = false;
+
+			ASSERT_EQ( allocations, 0u ) << "solver " << static_cast<int>( mode ) << " narrowphase " << static_cast<int>( type );
+		}
+
+		// the bodies are still held by their contacts
+		for ( unsigned i = 1u; i < physics.bodies().size(); i++ )
+			ASSERT_GT( physics.bodies()[i].position.y, 0.4f ) << "solver " << static_cast<int>( mode );
+	}
+
+	SolverConstraint::grain = grain;
+	physics.set_solver_mode( SolverMode::Sequential );
+	physics.exit();
+}
+
+TEST( allocations, sweep_and_prune_updates_without_allocating )
+{
+	// a row of boxes sliding back and forth over each other, pairs are added and removed every update
+	std::vector<RigidBody> bodies( 64u );
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		bodies[i].mesh = load_shared_mesh( "cube" );
+		bodies[i].position = vec3( 0.8f * i, 0.0f, 0.0f );
+	}
+
+	BroadphaseSAP sap;
+	unsigned added = 0u;
+	unsigned removed = 0u;
+	auto step = [&]( const unsigned update )
+	{
+		for ( unsigned i = 0u; i < bodies.size(); i += 2u )
+			bodies[i].position.x += update % 2u == 0u ? 0.5f : -0.5f;
+		sap.update( bodies );
+
+		added += static_cast<unsigned>( sap.added_pairs().size() );
+		removed += static_cast<unsigned>( sap.removed_pairs().size() );
+	};
+
+	for ( unsigned i = 0u; i < 4u; i++ )
+		step( i );
+
+	allocations = 0u;
+	counting = true;
+	for ( unsigned i = 4u; i < 20u; i++ )
+		step( i );
+	counting = false;
+
+	ASSERT_EQ( allocations, 0u );
+	ASSERT_GT( added, 0u );
+	ASSERT_GT( removed, 0u );
+}
+
+TEST( allocations, parallel_solver_steps_without_allocating )
+{
+	// a pool of its own, the workers are used whatever the cores of the machine
+	ThreadPool pool( 4u );
+
+	for ( const SolverMode mode : { SolverMode::Colored, SolverMode::Wide } )
+	{
+		std::vector<RigidBody> bodies;
+		std::vector<ContactManifold> contacts;
+		make_stacks( bodies, contacts, 40u, 5u );
+
+		SolverConstraint solver;
+		solver.set_iteration_count( 4 );
+		solver.set_baumgarte( 0.2f );
+		solver.set_mode( mode );
+		solver.set_thread_pool( &pool );
+		solver.solve_collision( contacts, 1.0f / 60.0f );
+
+		allocations = 0u;
+		counting = true;
+		for ( unsigned i = 0u; i < 10u; i++ )
+			solver.solve_collision( contacts, 1.0f / 60.0f );
+		counting = false;
+
+		ASSERT_EQ( allocations, 0u ) << "solver " << static_cast<int>( mode );
+	}
+}
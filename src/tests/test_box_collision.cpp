@@ -0,0 +1,128 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_box_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "box_collision.h"
+#include "collision.h"
+#include "narrowphase.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+
+/**
+* @brief deepest point of a manifold
+*/
+static float max_depth( const ContactManifold& contact )
+{
+	float depth = 0.0f;
+	for ( const ContactPoint& point : contact.points )
+		depth = glm::max( depth, point.depth );
+	return depth;
+}
+
+TEST( box_collision, resting_box_has_four_points )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody floor;
+	RigidBody box;
+	floor.mesh = box.mesh = cube;
+	floor.shape = box.shape = ShapeType::Box;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+	box.position = vec3( 0.3f, 0.95f, -0.2f );
+	box.rot = quat( vec3( 0.0f, 0.4f, 0.0f ) );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_box_box( floor, box, contact ) );
+	ASSERT_EQ( contact.body_A, &floor );
+	ASSERT_EQ( contact.points.size(), 4u );
+	ASSERT_NEAR( contact.normal.y, 1.0f, 1e-5f );
+	for ( const ContactPoint& point : contact.points )
+		ASSERT_NEAR( point.depth, 0.05f, 1e-4f );
+
+	// the features do not change while the box slides
+	ContactManifold moved;
+	box.position.x += 0.01f;
+	ASSERT_TRUE( overlap_box_box( floor, box, moved ) );
+	ASSERT_EQ( moved.feature, contact.feature );
+	for ( unsigned i = 0u; i < contact.points.size(); i++ )
+		ASSERT_EQ( moved.points[i].feature, contact.points[i].feature );
+
+	box.position.y = 1.01f;
+	ASSERT_FALSE( overlap_box_box( floor, box, contact ) );
+
+	delete cube;
+}
+
+TEST( box_collision, matches_sat )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 0.8f, 2.0f );
+
+	unsigned overlapping = 0u;
+	for ( unsigned i = 0u; i < 500u; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = b.mesh = cube;
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+
+		// exact separation of sat, the largest of every axis. Its face queries measure it in the
+		// scale of the reference body, so the boxes are not scaled here
+		const float separation = glm::max( glm::max( has_separating_axis_face( a, b ).separation,
+													 has_separating_axis_face( b, a ).separation ),
+										   has_separating_axis_edge_scalar( a, b ).separation );
+
+		// touching pairs may go either way
+		if ( std::abs( separation ) < 1e-3f )
+			continue;
+
+		ContactManifold box_contact;
+		const bool colliding = overlap_box_box( a, b, box_contact );
+		ASSERT_EQ( colliding, separation < 0.0f ) << "pair " << i;
+
+		if ( colliding )
+		{
+			ASSERT_FALSE( box_contact.points.empty() ) << "pair " << i;
+
+			// resting contacts are shallow, both find the same features there
+			ContactManifold sat_contact;
+			ASSERT_TRUE( overlap_sat( a, b, sat_contact ) );
+			if ( separation > -0.1f )
+			{
+				EXPECT_NEAR( max_depth( box_contact ), max_depth( sat_contact ), 2e-3f ) << "pair " << i;
+			}
+
+			// the normal goes from the first body of the manifold to the second
+			EXPECT_GT( dot( box_contact.normal, box_contact.body_B->position - box_contact.body_A->position ), 0.0f ) << "pair " << i;
+			overlapping++;
+		}
+	}
+	ASSERT_GT( overlapping, 100u );
+
+	delete cube;
+}
+
+TEST( box_collision, dispatch_by_shape )
+{
+	NarrowphasePolicy policy;
+	ASSERT_EQ( policy.shape_overlap( ShapeType::Box, ShapeType::Box ), static_cast<ShapeOverlap>( overlap_box_box ) );
+	ASSERT_EQ( policy.shape_overlap( ShapeType::Hull, ShapeType::Box ), nullptr );
+	ASSERT_EQ( policy.shape_overlap( ShapeType::Hull, ShapeType::Hull ), nullptr );
+
+	policy.set_shape_routines( false );
+	ASSERT_EQ( policy.shape_overlap( ShapeType::Box, ShapeType::Box ), nullptr );
+}
@@ -0,0 +1,179 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_broadphase.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "broadphase.h"
+#include "aabb_tree.h"
+#include "sweep_and_prune.h"
+#include "spatial_hash.h"
+#include "half_edge.h"
+#include "test_helpers.h"
+
+#include "math_utils.h"
+#include <algorithm>
+#include <random>
+
+/**
+* @brief random cubes inside a box of the given size
+*/
+static std::vector<RigidBody> random_bodies( const unsigned count, const float size, const unsigned seed )
+{
+	std::mt19937 generator( seed );
+	std::uniform_real_distribution<float> position( -size, size );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+
+	std::vector<RigidBody> bodies;
+	for ( unsigned i = 0u; i < count; i++ )
+	{
+		RigidBody body;
+		body.mesh = load_shared_mesh( "cube" );
+		body.mass = 1.0f;
+		body.position = vec3( position( generator ), position( generator ), position( generator ) );
+		body.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		bodies.push_back( body );
+	}
+	return bodies;
+}
+
+/**
+* @brief pairs whose tight bounding boxes overlap
+*/
+static std::vector<BodyPair> overlapping_pairs( const std::vector<RigidBody>& bodies )
+{
+	std::vector<BodyPair> pairs;
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+		for ( unsigned j = i + 1u; j < bodies.size(); j++ )
+			if ( overlap_aabb( compute_aabb( bodies[i] ), compute_aabb( bodies[j] ) ) )
+				pairs.push_back( BodyPair{ i, j } );
+	return pairs;
+}
+
+/**
+* @brief every pair of the reference has to be in the candidates
+*/
+static bool contains_pairs( const std::vector<BodyPair>& candidates, const std::vector<BodyPair>& reference )
+{
+	for ( const BodyPair& pair : reference )
+		if ( std::find( candidates.begin(), candidates.end(), pair ) == candidates.end() )
+			return false;
+	return true;
+}
+
+TEST( broadphase, aabb_contains_rotated_vertices )
+{
+	RigidBody body;
+	body.mesh = load_shared_mesh( "cube" );
+	body.position = vec3( 1.0f, -2.0f, 3.0f );
+	body.scl = vec3( 2.0f, 0.5f, 1.0f );
+	body.rot = quat( vec3( 0.3f, 1.1f, -0.7f ) );
+
+	const AABB aabb = compute_aabb( body );
+	const mat4 model = body.model();
+
+	for ( const vec3& vertex : body.mesh->vertices() )
+	{
+		const vec3 world = vec3( model * vec4( vertex, 1.0f ) );
+		ASSERT_TRUE( glm::all( glm::lessThanEqual( aabb.min, world + vec3( 0.0001f ) ) ) );
+		ASSERT_TRUE( glm::all( glm::greaterThanEqual( aabb.max, world - vec3( 0.0001f ) ) ) );
+	}
+}
+
+TEST( broadphase, tree_finds_every_overlapping_pair )
+{
+	std::vector<RigidBody> bodies = random_bodies( 300u, 8.0f, 1u );
+
+	BroadphaseTree tree;
+	tree.update( bodies );
+	ASSERT_TRUE( contains_pairs( tree.pairs(), overlapping_pairs( bodies ) ) );
+
+	// move the bodies so some of the leaves are reinserted
+	for ( unsigned i = 0u; i < bodies.size(); i += 3u )
+		bodies[i].position += vec3( 0.7f, -0.2f, 0.4f );
+
+	tree.update( bodies );
+	ASSERT_TRUE( contains_pairs( tree.pairs(), overlapping_pairs( bodies ) ) );
+	ASSERT_TRUE( std::is_sorted( tree.pairs().begin(), tree.pairs().end() ) );
+}
+
+TEST( broadphase, tree_stays_balanced )
+{
+	// bodies added in order along a line are the worst case for an unbalanced tree
+	std::vector<RigidBody> bodies = random_bodies( 1024u, 0.0f, 2u );
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+		bodies[i].position = vec3( 3.0f * i, 0.0f, 0.0f );
+
+	BroadphaseTree tree;
+	tree.update( bodies );
+
+	ASSERT_LE( tree.tree().height(), 20 );
+}
+
+TEST( broadphase, tree_tests_grow_slower_than_brute_force )
+{
+	const std::vector<RigidBody> bodies = random_bodies( 2000u, 40.0f, 3u );
+
+	BroadphaseBruteForce brute_force;
+	brute_force.update( bodies );
+
+	BroadphaseTree tree;
+	tree.update( bodies );
+
+	ASSERT_EQ( brute_force.pair_tests(), 2000u * 1999u / 2u );
+	ASSERT_LT( tree.pair_tests() * 10u, brute_force.pair_tests() );
+}
+
+TEST( broadphase, sweep_and_prune_tracks_overlapping_pairs )
+{
+	std::vector<RigidBody> bodies = random_bodies( 300u, 8.0f, 4u );
+
+	BroadphaseSAP sap;
+	sap.update( bodies );
+	ASSERT_EQ( sap.pairs(), overlapping_pairs( bodies ) );
+	ASSERT_EQ( sap.added_pairs().size(), sap.pairs().size() );
+
+	std::mt19937 generator( 5u );
+	std::uniform_real_distribution<float> offset( -0.3f, 0.3f );
+
+	for ( unsigned step = 0u; step < 10u; step++ )
+	{
+		std::vector<BodyPair> previous = sap.pairs();
+
+		for ( RigidBody& body : bodies )
+			body.position += vec3( offset( generator ), offset( generator ), offset( generator ) );
+
+		sap.update( bodies );
+		ASSERT_EQ( sap.pairs(), overlapping_pairs( bodies ) );
+
+		// the events turn the previous pairs into the current ones
+		for ( const BodyPair& pair : sap.removed_pairs() )
+			previous.erase( std::find( previous.begin(), previous.end(), pair ) );
+		for ( const BodyPair& pair : sap.added_pairs() )
+			previous.push_back( pair );
+		std::sort( previous.begin(), previous.end() );
+
+		ASSERT_EQ( previous, sap.pairs() );
+	}
+}
+
+TEST( broadphase, grid_matches_brute_force )
+{
+	std::vector<RigidBody> bodies = random_bodies( 1000u, 10.0f, 6u );
+
+	// a big floor is kept out of the grid
+	bodies[0].position = vec3( 0.0f, -10.0f, 0.0f );
+	bodies[0].scl = vec3( 40.0f, 1.0f, 40.0f );
+	bodies[0].rot = quat( vec3( 0.0f ) );
+
+	BroadphaseGrid grid;
+	grid.update( bodies );
+
+	ASSERT_EQ( grid.pairs(), overlapping_pairs( bodies ) );
+	ASSERT_LT( grid.pair_tests() * 10u, 1000u * 999u / 2u );
+}
@@ -0,0 +1,180 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "collision.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <set>
+#include <string>
+
+TEST( collision, every_edge_is_unique )
+{
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "sphere" } )
+	{
+		HalfEdgeMesh* mesh = load_mesh( name );
+
+		// closed meshes, V - E + F = 2 with the vertices left in the merged faces
+		std::set<unsigned> vertices;
+		for ( const HalfEdgeFace* face : mesh->faces() )
+			vertices.insert( face->m_vertices.begin(), face->m_vertices.end() );
+
+		const unsigned edges = static_cast<unsigned>( vertices.size() + mesh->faces().size() - 2u );
+		ASSERT_EQ( mesh->unique_edges().size(), edges ) << name;
+
+		for ( const UniqueEdge& edge : mesh->unique_edges() )
+		{
+			const FlatEdge& half_edge = mesh->flat_edges()[edge.edge];
+			ASSERT_EQ( edge.head, mesh->vertices()[half_edge.vertex] );
+			ASSERT_EQ( edge.normal_B, mesh->flat_faces()[mesh->flat_edges()[half_edge.twin].face].normal );
+		}
+
+		delete mesh;
+	}
+}
+
+TEST( collision, edge_query_matches_the_face_loops )
+{
+	std::vector<HalfEdgeMesh*> meshes = { load_mesh( "cube" ), load_mesh( "icosahedron" ), load_mesh( "cylinder" ) };
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 0.5f, 1.8f );
+	std::uniform_real_distribution<float> scale( 0.5f, 1.5f );
+
+	for ( unsigned i = 0u; i < 200u; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = meshes[i % meshes.size()];
+		b.mesh = meshes[( i / meshes.size() ) % meshes.size()];
+		a.position = vec3( angle( generator ), angle( generator ), angle( generator ) );
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.scl = vec3( scale( generator ), scale( generator ), scale( generator ) );
+		b.position = a.position + normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+
+		const ContactEdge unique = has_separating_axis_edge( a, b );
+		const ContactEdge bruteforce = has_separating_axis_edge_bruteforce( a, b );
+
+		// both stop at the first separating pair, which may not be the same
+		if ( bruteforce.separation > 0.0f )
+			ASSERT_GT( unique.separation, 0.0f ) << "pair " << i;
+		else
+			ASSERT_NEAR( unique.separation, bruteforce.separation, 1e-4f ) << "pair " << i;
+	}
+
+	for ( HalfEdgeMesh* mesh : meshes )
+		delete mesh;
+}
+
+TEST( collision, wide_edge_query_matches_the_scalar_query )
+{
+	std::vector<HalfEdgeMesh*> meshes = { load_mesh( "cube" ), load_mesh( "cylinder" ), load_mesh( "sphere" ) };
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 0.5f, 2.2f );
+
+	for ( unsigned i = 0u; i < 90u; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = meshes[i % meshes.size()];
+		b.mesh = meshes[( i / meshes.size() ) % meshes.size()];
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+
+		const ContactEdge wide = has_separating_axis_edge( a, b );
+		const ContactEdge scalar = has_separating_axis_edge_scalar( a, b );
+
+		// the lanes are visited in order, the same pair is found
+		ASSERT_NEAR( wide.separation, scalar.separation, 1e-5f ) << "pair " << i;
+		ASSERT_EQ( wide.edge_A, scalar.edge_A ) << "pair " << i;
+		ASSERT_EQ( wide.edge_B, scalar.edge_B ) << "pair " << i;
+	}
+
+	for ( HalfEdgeMesh* mesh : meshes )
+		delete mesh;
+}
+
+TEST( collision, reduced_manifold_keeps_the_deepest_and_largest_points )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+	HalfEdgeMesh* cylinder = load_mesh( "cylinder" );
+
+	// a cylinder of radius 1 slightly tilted on its cap, every vertex of the cap is clipped
+	RigidBody floor;
+	RigidBody body;
+	floor.mesh = cube;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+	body.mesh = cylinder;
+	body.position = vec3( 0.0f, 2.45f, 0.0f );
+	body.rot = quat( vec3( 0.002f, 0.0f, 0.0f ) );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_sat( floor, body, contact ) );
+	const unsigned count = static_cast<unsigned>( contact.points.size() );
+	ASSERT_GT( count, 4u );
+
+	float deepest = 0.0f;
+	for ( const ContactPoint& point : contact.points )
+		deepest = glm::max( deepest, point.depth );
+
+	// 0 keeps every point
+	ContactManifold reduced = contact;
+	ASSERT_EQ( reduce_manifold( reduced, 0u ), 0u );
+	ASSERT_EQ( reduced.points.size(), count );
+
+	ASSERT_EQ( reduce_manifold( reduced, 4u ), count - 4u );
+	ASSERT_EQ( reduced.points.size(), 4u );
+	ASSERT_EQ( reduced.points[0].depth, deepest );
+
+	// the largest quad in the cap is a square of area 2, for every order of the points one pair of
+	// segments are the diagonals
+	const vec3 a = reduced.points[0].point_A;
+	const vec3 b = reduced.points[1].point_A;
+	const vec3 c = reduced.points[2].point_A;
+	const vec3 d = reduced.points[3].point_A;
+	const float area = glm::max( glm::length( cross( c - a, d - b ) ), glm::max( glm::length( cross( b - a, d - c ) ), glm::length( cross( d - a, c - b ) ) ) ) * 0.5f;
+	ASSERT_GT( area, 1.9f );
+
+	ContactManifold single = contact;
+	ASSERT_EQ( reduce_manifold( single, 1u ), count - 1u );
+	ASSERT_EQ( single.points[0].depth, deepest );
+
+	delete cube;
+	delete cylinder;
+}
+
+TEST( collision, clipped_caps_keep_every_point )
+{
+	HalfEdgeMesh* cylinder = load_mesh( "cylinder" );
+
+	// two caps of 12 vertices, turned half a side from each other, clip to 24 points
+	RigidBody bottom;
+	RigidBody top;
+	bottom.mesh = top.mesh = cylinder;
+	top.position = vec3( 0.0f, 3.99f, 0.0f );
+	top.rot = quat( vec3( 0.0f, glm::pi<float>() / 12.0f, 0.0f ) );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_sat( bottom, top, contact ) );
+	ASSERT_EQ( contact.points.size(), 2u * max_face_vertices );
+
+	ContactManifold reduced = contact;
+	ASSERT_EQ( reduce_manifold( reduced, 0u ), 0u );
+	ASSERT_EQ( reduced.points.size(), contact.points.size() );
+	ASSERT_EQ( reduce_manifold( reduced, 4u ), contact.points.size() - 4u );
+
+	delete cylinder;
+}
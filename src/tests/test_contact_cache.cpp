@@ -0,0 +1,105 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_contact_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "contact_cache.h"
+
+#include "math_utils.h"
+
+/**
+* @brief contact between two bodies with a point for every feature
+*/
+static ContactManifold make_contact( std::vector<RigidBody>& bodies, const unsigned a, const unsigned b, const std::vector<unsigned>& features )
+{
+	ContactManifold contact;
+	contact.body_A = &bodies[a];
+	contact.body_B = &bodies[b];
+	contact.feature = 7u;
+
+	for ( const unsigned feature : features )
+	{
+		ContactPoint point;
+		point.feature = feature;
+		contact.points.push_back( point );
+	}
+
+	return contact;
+}
+
+TEST( contact_cache, matching_features_keep_their_impulse )
+{
+	std::vector<RigidBody> bodies( 2u );
+	for ( auto& body : bodies )
+		body.mass = 1.0f;
+
+	std::vector<ContactManifold> contacts{ make_contact( bodies, 0u, 1u, { 1u, 2u } ) };
+	contacts[0].points[0].impulse = 2.0f;
+	contacts[0].points[1].impulse = 4.0f;
+	contacts[0].impulse_u = 1.0f;
+
+	ContactCache cache;
+	cache.store( contacts, bodies );
+	ASSERT_EQ( cache.size(), 1u );
+
+	// point 2 is gone and point 3 is new
+	contacts = { make_contact( bodies, 0u, 1u, { 3u, 1u } ) };
+	cache.warm_start( contacts, bodies );
+
+	ASSERT_EQ( cache.matched_points(), 1u );
+	ASSERT_FLOAT_EQ( contacts[0].points[0].impulse, 0.0f );
+	ASSERT_FLOAT_EQ( contacts[0].points[1].impulse, 2.0f * ContactCache::warm_start_factor );
+
+	// friction is only kept when every point matches
+	ASSERT_FLOAT_EQ( contacts[0].impulse_u, 0.0f );
+}
+
+TEST( contact_cache, different_reference_is_not_warm_started )
+{
+	std::vector<RigidBody> bodies( 2u );
+	for ( auto& body : bodies )
+		body.mass = 1.0f;
+
+	std::vector<ContactManifold> contacts{ make_contact( bodies, 0u, 1u, { 1u } ) };
+	contacts[0].points[0].impulse = 2.0f;
+
+	ContactCache cache;
+	cache.store( contacts, bodies );
+
+	// same pair with the reference face in the other body
+	contacts = { make_contact( bodies, 1u, 0u, { 1u } ) };
+	cache.warm_start( contacts, bodies );
+
+	ASSERT_EQ( cache.matched_points(), 0u );
+	ASSERT_FLOAT_EQ( contacts[0].points[0].impulse, 0.0f );
+}
+
+TEST( contact_cache, separated_pairs_are_evicted )
+{
+	std::vector<RigidBody> bodies( 4u );
+	for ( auto& body : bodies )
+		body.mass = 1.0f;
+
+	std::vector<ContactManifold> contacts{ make_contact( bodies, 0u, 1u, { 1u } ),
+										   make_contact( bodies, 2u, 3u, { 1u } ) };
+
+	ContactCache cache;
+	cache.store( contacts, bodies );
+	ASSERT_EQ( cache.size(), 2u );
+
+	// the sleeping pair is kept, the awake one stopped touching
+	bodies[2].sleep();
+	bodies[3].sleep();
+	cache.store( {}, bodies );
+	ASSERT_EQ( cache.size(), 1u );
+
+	bodies[2].wake();
+	cache.store( {}, bodies );
+	ASSERT_EQ( cache.size(), 0u );
+}
@@ -0,0 +1,117 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_gjk.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "gjk.h"
+#include "collision.h"
+#include "narrowphase.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+
+TEST( gjk, penetration_of_two_boxes )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody a;
+	RigidBody b;
+	a.mesh = b.mesh = cube;
+	b.position = vec3( 0.9f, 0.2f, -0.1f );
+
+	Simplex simplex;
+	ASSERT_TRUE( gjk_intersect( a, b, simplex ) );
+
+	Penetration penetration;
+	ASSERT_TRUE( epa_penetration( a, b, simplex, penetration ) );
+	ASSERT_NEAR( penetration.depth, 0.1f, 1e-3f );
+	ASSERT_NEAR( penetration.normal.x, 1.0f, 1e-3f );
+
+	// a face contact is clipped as with sat
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_gjk( a, b, contact ) );
+	ASSERT_EQ( contact.points.size(), 4u );
+	for ( const ContactPoint& point : contact.points )
+		ASSERT_NEAR( point.depth, 0.1f, 1e-3f );
+
+	b.position.x = 1.1f;
+	ASSERT_FALSE( gjk_intersect( a, b, simplex ) );
+
+	delete cube;
+}
+
+TEST( gjk, depth_matches_sat )
+{
+	std::vector<HalfEdgeMesh*> meshes = { load_mesh( "cube" ), load_mesh( "icosahedron" ), load_mesh( "cylinder" ) };
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> distance( 0.3f, 1.8f );
+
+	unsigned overlapping = 0u;
+	for ( unsigned i = 0u; i < 300u; i++ )
+	{
+		RigidBody a;
+		RigidBody b;
+		a.mesh = meshes[i % meshes.size()];
+		b.mesh = meshes[( i / meshes.size() ) % meshes.size()];
+		a.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+		b.position = normalize( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) * distance( generator );
+
+		// exact separation of sat, the largest of every axis
+		const float separation = glm::max( glm::max( has_separating_axis_face( a, b ).separation,
+													 has_separating_axis_face( b, a ).separation ),
+										   has_separating_axis_edge_scalar( a, b ).separation );
+
+		// touching pairs may go either way
+		if ( std::abs( separation ) < 1e-3f )
+			continue;
+
+		Simplex simplex;
+		const bool intersect = gjk_intersect( a, b, simplex );
+		ASSERT_EQ( intersect, separation < 0.0f ) << "pair " << i;
+
+		if ( intersect )
+		{
+			Penetration penetration;
+			ASSERT_TRUE( epa_penetration( a, b, simplex, penetration ) ) << "pair " << i;
+			EXPECT_NEAR( penetration.depth, -separation, 2e-3f ) << "pair " << i << " " << i % 3 << ( i / 3 ) % 3;
+			overlapping++;
+		}
+	}
+	ASSERT_GT( overlapping, 50u );
+
+	for ( HalfEdgeMesh* mesh : meshes )
+		delete mesh;
+}
+
+TEST( gjk, policy_picks_by_vertex_count )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+	HalfEdgeMesh* sphere = load_mesh( "sphere" );
+
+	NarrowphasePolicy policy;
+	ASSERT_FALSE( policy.use_gjk( cube, cube ) );
+	ASSERT_TRUE( policy.use_gjk( sphere, sphere ) );
+
+	// a pair forced to sat, in any order
+	policy.set_pair_type( sphere, sphere, NarrowphaseType::Sat );
+	policy.set_pair_type( sphere, cube, NarrowphaseType::Gjk );
+	ASSERT_FALSE( policy.use_gjk( sphere, sphere ) );
+	ASSERT_TRUE( policy.use_gjk( cube, sphere ) );
+
+	policy.clear_pairs();
+	policy.set_type( NarrowphaseType::Gjk );
+	ASSERT_TRUE( policy.use_gjk( cube, cube ) );
+
+	delete cube;
+	delete sphere;
+}
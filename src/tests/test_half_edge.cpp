@@ -9,9 +9,15 @@ Creation date: 01/20/2020
 ----------------------------------------------------------------------------------------------------------*/
 #include "half_edge.h"
 #include "mesh.h"
+#include "test_helpers.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+
 TEST( half_edge, creating_a_face_links_edges_correctly )
 {
 	vec3 p = {  0.0f, 0.0f, 0.0f };
@@ -117,4 +123,153 @@ TEST( half_edge, hill_climbing )
 
 	vec3 vertex = cube.hill_climbing( normalize( vec3( 1.0f, 1.0f, 1.0f ) ) );
 	ASSERT_EQ( vertex, vec3( 0.5f, 0.5f, 0.5f ) );
-}
\ No newline at end of file
+}
+
+TEST( half_edge, support_vertex_from_any_start )
+{
+	HalfEdgeMesh* sphere = load_mesh( "sphere" );
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.0f, 1.0f );
+	std::vector<vec3> directions;
+	for ( unsigned i = 0u; i < 32u; i++ )
+		directions.push_back( normalize( vec3( coordinate( generator ), coordinate( generator ), coordinate( generator ) ) ) );
+
+	// the same query from several threads at once
+	auto climb = [&]( const unsigned first_start, bool& correct )
+	{
+		correct = true;
+		for ( const vec3& dir : directions )
+		{
+			const float best = dot( sphere->hill_climbing_bruteforce( dir ), dir );
+			for ( unsigned start = first_start; start < sphere->vertices().size(); start += 4u )
+			{
+				unsigned steps = 0u;
+				const unsigned vertex = sphere->support_vertex( dir, start, &steps );
+				correct &= dot( sphere->vertices()[vertex], dir ) == best;
+
+				// already at the support vertex
+				sphere->support_vertex( dir, vertex, &steps );
+				correct &= steps == 0u;
+			}
+		}
+	};
+
+	bool correct[4];
+	std::vector<std::thread> threads;
+	for ( unsigned i = 0u; i < 4u; i++ )
+		threads.emplace_back( climb, i, std::ref( correct[i] ) );
+	for ( std::thread& thread : threads )
+		thread.join();
+
+	for ( unsigned i = 0u; i < 4u; i++ )
+		ASSERT_TRUE( correct[i] );
+
+	delete sphere;
+}
+
+TEST( half_edge, hierarchy_support_matches_bruteforce )
+{
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.0f, 1.0f );
+
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "sphere", "gourd" } )
+	{
+		// only the large meshes build it when they are loaded
+		HalfEdgeMesh* half_edge = load_mesh( name );
+		half_edge->build_hierarchy();
+
+		// every level is smaller and keeps only vertices of the one below
+		const std::vector<DkLevel>& levels = half_edge->hierarchy().levels();
+		ASSERT_FALSE( levels.empty() ) << name;
+		for ( unsigned i = 1u; i < levels.size(); i++ )
+		{
+			ASSERT_LT( levels[i].vertices.size(), levels[i - 1u].vertices.size() ) << name;
+			for ( unsigned vertex : levels[i].vertices )
+				ASSERT_TRUE( std::binary_search( levels[i - 1u].vertices.begin(), levels[i - 1u].vertices.end(), vertex ) ) << name;
+		}
+
+		for ( unsigned i = 0u; i < 500u; i++ )
+		{
+			const vec3 dir = normalize( vec3( coordinate( generator ), coordinate( generator ), coordinate( generator ) ) );
+			const unsigned vertex = half_edge->hierarchy_support( dir );
+			ASSERT_NEAR( dot( half_edge->vertices()[vertex], dir ), dot( half_edge->hill_climbing_bruteforce( dir ), dir ), 1e-5f ) << name;
+		}
+
+		delete half_edge;
+	}
+}
+
+TEST( half_edge, wide_support_matches_bruteforce )
+{
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.0f, 1.0f );
+
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "sphere" } )
+	{
+		HalfEdgeMesh* half_edge = load_mesh( name );
+
+		// small meshes search every vertex by default
+		const bool small = half_edge->vertices().size() <= HalfEdgeMesh::wide_vertex_count;
+		ASSERT_EQ( half_edge->support_method() == SupportMethod::Wide, small ) << name;
+
+		// the same vertex, the first one on ties, also along the axes of the cube faces
+		std::vector<vec3> directions = { vec3( 1.0f, 0.0f, 0.0f ), vec3( 0.0f, -1.0f, 0.0f ), vec3( 0.0f, 0.0f, 1.0f ) };
+		for ( unsigned i = 0u; i < 200u; i++ )
+			directions.push_back( normalize( vec3( coordinate( generator ), coordinate( generator ), coordinate( generator ) ) ) );
+
+		for ( const vec3& dir : directions )
+			ASSERT_EQ( half_edge->vertices()[half_edge->wide_support( dir )], half_edge->hill_climbing_bruteforce( dir ) ) << name;
+
+		delete half_edge;
+	}
+}
+
+TEST( half_edge, flat_storage_matches_the_linked_faces )
+{
+	for ( const char* name : { "cube", "icosahedron", "cylinder", "gourd" } )
+	{
+		Mesh mesh = load_obj( ( std::string( "../resources/meshes/" ) + name + ".obj" ).c_str() );
+
+		HalfEdgeMesh half_edge;
+		half_edge.add_vertices( mesh.vertices );
+		for ( unsigned i = 0; i < mesh.indices.size(); i++ )
+			half_edge.add_face( mesh.indices[i].x,
+								mesh.indices[i].y,
+								mesh.indices[i].z );
+
+		half_edge.link_twins();
+		half_edge.merge_faces();
+
+		const std::vector<FlatEdge>& edges = half_edge.flat_edges();
+		const std::vector<FlatFace>& faces = half_edge.flat_faces();
+		ASSERT_EQ( faces.size(), half_edge.faces().size() ) << name;
+
+		for ( unsigned i = 0u; i < faces.size(); i++ )
+		{
+			const HalfEdgeFace* face = half_edge.faces()[i];
+			ASSERT_EQ( faces[i].normal, face->m_normal ) << name;
+
+			// walk both loops at the same time
+			const HalfEdge* edge = face->m_edge;
+			unsigned flat = faces[i].edge;
+			for ( unsigned j = 0u; j < faces[i].vertex_count; j++ )
+			{
+				ASSERT_EQ( edges[flat].face, i ) << name;
+				ASSERT_EQ( edges[flat].vertex, edge->vertex ) << name;
+				ASSERT_EQ( half_edge.face_vertices()[faces[i].first_vertex + j], edge->vertex ) << name;
+				ASSERT_EQ( edges[edges[flat].next].prev, flat ) << name;
+
+				// closed meshes, the twin goes back and starts at the end of the edge
+				ASSERT_NE( edges[flat].twin, no_edge ) << name;
+				ASSERT_EQ( edges[edges[flat].twin].twin, flat ) << name;
+				ASSERT_EQ( edges[edges[flat].twin].vertex, edge->twin->vertex ) << name;
+
+				edge = edge->next;
+				flat = edges[flat].next;
+			}
+			ASSERT_EQ( edge, face->m_edge ) << name;
+			ASSERT_EQ( flat, faces[i].edge ) << name;
+		}
+	}
+}
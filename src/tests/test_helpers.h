@@ -0,0 +1,97 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_helpers.h
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#pragma once
+
+// meshes and bodies shared by the tests and the benchmarks
+
+#include "physics.h"
+#include "mesh.h"
+
+#include <map>
+#include <string>
+
+/**
+* @brief build the half edge mesh of an obj file, as the physics does
+* @param name	file name in the meshes folder, without extension
+* @return new half edge mesh
+*/
+inline HalfEdgeMesh* load_mesh( const std::string& name )
+{
+	return create_half_edge_mesh( load_obj( ( "../resources/meshes/" + name + ".obj" ).c_str() ) );
+}
+
+/**
+* @brief half edge mesh of an obj file built once and kept for the whole run, never deleted
+* @param name	file name in the meshes folder, without extension
+* @return shared half edge mesh
+*/
+inline HalfEdgeMesh* load_shared_mesh( const std::string& name )
+{
+	static std::map<std::string, HalfEdgeMesh*> meshes;
+
+	HalfEdgeMesh*& mesh = meshes[name];
+	if ( mesh == nullptr )
+		mesh = load_mesh( name );
+	return mesh;
+}
+
+/**
+* @brief	unit boxes stacked in columns over a static floor (body 0), falling into each other,
+*			with a contact of 4 points for every box
+* @param bodies
+* @param contacts
+* @param columns
+* @param height	boxes in every column
+*/
+inline void make_stacks( std::vector<RigidBody>& bodies, std::vector<ContactManifold>& contacts,
+						 const unsigned columns, const unsigned height )
+{
+	bodies.assign( 1u + columns * height, RigidBody() );
+
+	for ( unsigned i = 0u; i < bodies.size(); i++ )
+	{
+		RigidBody& body = bodies[i];
+		body.mass = i == 0u ? 0.0f : 1.0f;
+		body.friction = 0.5f;
+		body.position = i == 0u ? vec3( 0.0f, -0.5f, 0.0f )
+								: vec3( 2.0f * ( ( i - 1u ) / height ), 0.5f + ( i - 1u ) % height, 0.0f );
+		body.linear_momentum = i == 0u ? vec3( 0.0f ) : vec3( 0.1f * ( i % 3u ), -1.0f, 0.0f );
+		body.linear_velocity = body.linear_momentum * body.inv_mass();
+		body.set_inertia( mat3( 1.0f / 6.0f ) );
+	}
+
+	contacts.clear();
+	for ( unsigned column = 0u; column < columns; column++ )
+	{
+		for ( unsigned level = 0u; level < height; level++ )
+		{
+			RigidBody* top = &bodies[1u + column * height + level];
+			RigidBody* bottom = level == 0u ? &bodies[0] : top - 1;
+
+			ContactManifold contact;
+			contact.body_A = bottom;
+			contact.body_B = top;
+			contact.normal = vec3( 0.0f, 1.0f, 0.0f );
+
+			const vec3 base = top->position - vec3( 0.0f, 0.5f, 0.0f );
+			for ( const vec3 corner : { vec3( -0.5f, 0.0f, -0.5f ), vec3( 0.5f, 0.0f, -0.5f ),
+										vec3( 0.5f, 0.0f, 0.5f ), vec3( -0.5f, 0.0f, 0.5f ) } )
+			{
+				ContactPoint point;
+				point.point_A = base + corner;
+				point.point_B = base + corner;
+				point.depth = 0.02f;
+				contact.points.push_back( point );
+			}
+
+			contacts.push_back( contact );
+		}
+	}
+}
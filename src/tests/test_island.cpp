@@ -0,0 +1,147 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_island.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "island.h"
+#include "physics.h"
+
+#include "math_utils.h"
+
+/**
+* @brief contact between two bodies of the array
+*/
+static ContactManifold make_contact( std::vector<RigidBody>& bodies, const unsigned a, const unsigned b )
+{
+	ContactManifold contact;
+	contact.body_A = &bodies[a];
+	contact.body_B = &bodies[b];
+	return contact;
+}
+
+TEST( island, static_bodies_do_not_join_islands )
+{
+	// 0 - 1 - 2 (static) - 3    4
+	std::vector<RigidBody> bodies( 5u );
+	for ( auto& body : bodies )
+		body.mass = 1.0f;
+	bodies[2].mass = 0.0f;
+
+	std::vector<ContactManifold> contacts;
+	contacts.push_back( make_contact( bodies, 0u, 1u ) );
+	contacts.push_back( make_contact( bodies, 1u, 2u ) );
+	contacts.push_back( make_contact( bodies, 2u, 3u ) );
+
+	IslandBuilder islands;
+	islands.build( bodies, contacts );
+
+	ASSERT_EQ( islands.island_count(), 3u );
+	ASSERT_EQ( bodies[0].island, bodies[1].island );
+	ASSERT_NE( bodies[1].island, bodies[3].island );
+	ASSERT_NE( bodies[3].island, bodies[4].island );
+}
+
+TEST( island, islands_sleep_together )
+{
+	std::vector<RigidBody> bodies( 3u );
+	for ( auto& body : bodies )
+		body.mass = 1.0f;
+
+	// body 1 keeps moving, so its island stays awake
+	bodies[1].linear_velocity = vec3( 1.0f, 0.0f, 0.0f );
+
+	std::vector<ContactManifold> contacts;
+	contacts.push_back( make_contact( bodies, 0u, 1u ) );
+
+	IslandBuilder islands;
+	const float dt = 1.0f / 60.0f;
+	for ( float time = 0.0f; time < IslandBuilder::time_to_sleep + dt; time += dt )
+	{
+		islands.build( bodies, contacts );
+		islands.update_sleep( bodies, dt );
+	}
+
+	ASSERT_TRUE( bodies[0].awake );
+	ASSERT_TRUE( bodies[1].awake );
+	ASSERT_FALSE( bodies[2].awake );
+
+	// once it stops the whole island falls asleep
+	bodies[1].linear_velocity = vec3( 0.0f );
+	for ( float time = 0.0f; time < IslandBuilder::time_to_sleep + dt; time += dt )
+	{
+		islands.build( bodies, contacts );
+		islands.update_sleep( bodies, dt );
+	}
+
+	ASSERT_FALSE( bodies[0].awake );
+	ASSERT_FALSE( bodies[1].awake );
+	ASSERT_EQ( bodies[0].island, bodies[1].island );
+}
+
+/**
+* @brief	height of the middle box of a sleeping stack of two boxes woken up by a third one
+*			dropped on it, at every step
+* @param type	broadphase of the physics
+*/
+static std::vector<float> wake_stack( const BroadphaseType type )
+{
+	Physics& physics = Physics::get_instance();
+	physics.initialize( load_meshes() );
+	physics.set_broadphase( type );
+	physics.set_sleeping( true );
+	physics.set_solver_mode( SolverMode::Sequential );
+	physics.set_narrowphase( NarrowphaseType::Auto );
+	physics.set_shape_routines( true );
+
+	auto add_box = [&]( const vec3& position, const vec3& scale, const float mass )
+	{
+		RigidBody body;
+		body.mesh = physics.meshes()[0u];
+		body.shape = ShapeType::Box;
+		body.position = position;
+		body.scl = scale;
+		body.mass = mass;
+		body.friction = 0.5f;
+		body.set_inertia( body.mesh->compute_intertia_tensor() * mass );
+		physics.add_body( body );
+	};
+
+	add_box( vec3( 0.0f, -0.5f, 0.0f ), vec3( 20.0f, 1.0f, 20.0f ), 0.0f );
+	add_box( vec3( 0.0f, 0.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+	add_box( vec3( 0.0f, 1.5f, 0.0f ), vec3( 1.0f ), 1.0f );
+	add_box( vec3( 0.1f, 30.0f, 0.0f ), vec3( 1.0f ), 1.0f );
+
+	std::vector<float> heights;
+	for ( unsigned i = 0u; i < 240u; i++ )
+	{
+		physics.update( 1.0f / 60.0f );
+		heights.push_back( physics.bodies()[2].position.y );
+	}
+
+	// back to the default broadphase for the other tests
+	physics.set_broadphase( BroadphaseType::Tree );
+	physics.exit();
+	return heights;
+}
+
+TEST( island, stack_woken_by_an_impact_matches_brute_force )
+{
+	// the stack has to be asleep before the impact for the test to mean anything
+	const std::vector<float> brute_force = wake_stack( BroadphaseType::BruteForce );
+	ASSERT_EQ( brute_force[100], brute_force[140] );
+	ASSERT_NE( brute_force[140], brute_force[160] );
+
+	// the woken bodies find their support contacts in the same step with every broadphase
+	for ( const BroadphaseType type : { BroadphaseType::Tree, BroadphaseType::SweepAndPrune, BroadphaseType::Grid } )
+	{
+		const std::vector<float> heights = wake_stack( type );
+		for ( unsigned i = 0u; i < brute_force.size(); i++ )
+			ASSERT_NEAR( heights[i], brute_force[i], 1e-3f ) << "broadphase " << static_cast<int>( type ) << " step " << i;
+	}
+}
@@ -0,0 +1,151 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_manifold_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "manifold_cache.h"
+#include "box_collision.h"
+#include "collision.h"
+#include "narrowphase.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+
+TEST( manifold_cache, small_motion_reprojects_the_points )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	// the floor is the first body of the pair and the box the reference of the manifold
+	RigidBody floor;
+	RigidBody box;
+	floor.mesh = box.mesh = cube;
+	floor.shape = box.shape = ShapeType::Box;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+	box.position = vec3( 0.3f, 0.95f, -0.2f );
+	box.rot = quat( vec3( 0.0f, 0.4f, 0.0f ) );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_box_box( box, floor, contact ) );
+	ASSERT_EQ( contact.body_A, &box );
+
+	PersistentManifold manifold;
+	store_manifold( manifold, floor, box, &contact, make_body_transform( floor ), make_body_transform( box ) );
+	ASSERT_TRUE( manifold.valid );
+	ASSERT_TRUE( manifold.swapped );
+
+	// sinking and sliding a bit gives the points of the full query, the points move with the
+	// bodies instead of being clipped again so they only drift as far as the bodies slide and
+	// turn, the corners of the box are closer than 1 to its center
+	box.position += vec3( 0.002f, -0.001f, 0.001f );
+	box.rot = quat( vec3( 0.0f, 0.405f, 0.0f ) );
+
+	ContactManifold refreshed;
+	ASSERT_TRUE( refresh_manifold( manifold, floor, box, refreshed, make_body_transform( floor ), make_body_transform( box ) ) );
+	ASSERT_TRUE( manifold.refreshed );
+
+	const float drift = ManifoldCache::max_translation + ManifoldCache::max_rotation;
+	ContactManifold full;
+	ASSERT_TRUE( overlap_box_box( box, floor, full ) );
+	ASSERT_EQ( refreshed.body_A, &box );
+	ASSERT_EQ( refreshed.feature, full.feature );
+	ASSERT_EQ( refreshed.points.size(), full.points.size() );
+	ASSERT_NEAR( glm::length( refreshed.normal - full.normal ), 0.0f, 1e-5f );
+	for ( unsigned i = 0u; i < full.points.size(); i++ )
+	{
+		ASSERT_EQ( refreshed.points[i].feature, full.points[i].feature );
+		ASSERT_NEAR( refreshed.points[i].depth, full.points[i].depth, 1e-5f );
+		ASSERT_LT( glm::length( refreshed.points[i].point_A - full.points[i].point_A ), drift );
+		ASSERT_LT( glm::length( refreshed.points[i].point_B - full.points[i].point_B ), drift );
+	}
+
+	delete cube;
+}
+
+TEST( manifold_cache, large_motion_needs_a_full_query )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody floor;
+	RigidBody box;
+	floor.mesh = box.mesh = cube;
+	floor.shape = box.shape = ShapeType::Box;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+	box.position = vec3( 0.0f, 0.998f, 0.0f );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_box_box( floor, box, contact ) );
+
+	PersistentManifold manifold;
+	store_manifold( manifold, floor, box, &contact, make_body_transform( floor ), make_body_transform( box ) );
+	ASSERT_FALSE( manifold.swapped );
+
+	// moved, turned or lifted off the floor
+	const vec3 position = box.position;
+	ContactManifold refreshed;
+
+	box.position.x += 0.1f;
+	ASSERT_FALSE( refresh_manifold( manifold, floor, box, refreshed, make_body_transform( floor ), make_body_transform( box ) ) );
+
+	box.position = position;
+	box.rot = quat( vec3( 0.1f, 0.0f, 0.0f ) );
+	ASSERT_FALSE( refresh_manifold( manifold, floor, box, refreshed, make_body_transform( floor ), make_body_transform( box ) ) );
+
+	box.rot = quat( 1.0f, 0.0f, 0.0f, 0.0f );
+	box.position.y += 0.003f;
+	ASSERT_FALSE( refresh_manifold( manifold, floor, box, refreshed, make_body_transform( floor ), make_body_transform( box ) ) );
+
+	// separated pairs are never reprojected
+	store_manifold( manifold, floor, box, nullptr, make_body_transform( floor ), make_body_transform( box ) );
+	box.position = position;
+	ASSERT_FALSE( refresh_manifold( manifold, floor, box, refreshed, make_body_transform( floor ), make_body_transform( box ) ) );
+
+	delete cube;
+}
+
+TEST( manifold_cache, pairs_not_queried_are_evicted )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody floor;
+	RigidBody box;
+	floor.mesh = box.mesh = cube;
+	floor.shape = box.shape = ShapeType::Box;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+	box.position = vec3( 0.0f, 0.998f, 0.0f );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_box_box( floor, box, contact ) );
+
+	// only the pairs in contact are kept
+	ManifoldCache cache;
+	cache.store( 0u, 1u, floor, box, &contact, make_body_transform( floor ), make_body_transform( box ) );
+	cache.store( 0u, 2u, floor, box, nullptr, make_body_transform( floor ), make_body_transform( box ) );
+	ASSERT_EQ( cache.find( 0u, 2u ), nullptr );
+	ASSERT_EQ( cache.find( 1u, 0u ), nullptr );
+	cache.end_step();
+	ASSERT_EQ( cache.size(), 1u );
+	ASSERT_EQ( cache.queries(), 1u );
+
+	PersistentManifold* manifold = cache.find( 0u, 1u );
+	ASSERT_NE( manifold, nullptr );
+	ASSERT_TRUE( refresh_manifold( *manifold, floor, box, contact, make_body_transform( floor ), make_body_transform( box ) ) );
+	cache.end_step();
+	ASSERT_EQ( cache.refreshed(), 1u );
+
+	// not queried in a step
+	cache.end_step();
+	ASSERT_EQ( cache.size(), 0u );
+
+	cache.store( 0u, 1u, floor, box, &contact, make_body_transform( floor ), make_body_transform( box ) );
+	cache.clear();
+	ASSERT_EQ( cache.size(), 0u );
+
+	delete cube;
+}
@@ -0,0 +1,86 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_profiler.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "profiler.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+TEST( profiler, scopes_are_added_to_the_frame )
+{
+	Profiler& profiler = Profiler::get_instance();
+	profiler.end_frame();
+
+	const unsigned solver = static_cast<unsigned>( ProfilePhase::Solver );
+
+	profiler.record( ProfilePhase::Solver, 100, 400 );
+	profiler.record( ProfilePhase::Solver, 500, 600 );
+	profiler.record( ProfilePhase::Broadphase, 0, 50 );
+	profiler.end_frame();
+
+	ASSERT_EQ( profiler.last_frame().calls[solver], 2u );
+	ASSERT_EQ( profiler.last_frame().nanoseconds[solver], 400 );
+	ASSERT_EQ( profiler.last_frame().calls[static_cast<unsigned>( ProfilePhase::Broadphase )], 1u );
+
+	// the next frame starts empty
+	profiler.end_frame();
+	ASSERT_EQ( profiler.last_frame().calls[solver], 0u );
+}
+
+#if PROFILER_ENABLED
+TEST( profiler, frame_scope_closes_the_frame )
+{
+	Profiler& profiler = Profiler::get_instance();
+	profiler.end_frame();
+
+	{
+		PROFILE_FRAME();
+		PROFILE_SCOPE( ProfilePhase::Integration );
+	}
+
+	ASSERT_EQ( profiler.last_frame().calls[static_cast<unsigned>( ProfilePhase::Step )], 1u );
+	ASSERT_EQ( profiler.last_frame().calls[static_cast<unsigned>( ProfilePhase::Integration )], 1u );
+	ASSERT_GE( profiler.last_frame().nanoseconds[static_cast<unsigned>( ProfilePhase::Step )],
+			   profiler.last_frame().nanoseconds[static_cast<unsigned>( ProfilePhase::Integration )] );
+}
+#endif
+
+TEST( profiler, capture_exports_a_chrome_trace )
+{
+	Profiler& profiler = Profiler::get_instance();
+	const std::string filename = "test_profiler_trace.json";
+
+	profiler.capture( 2u, filename );
+	profiler.record( ProfilePhase::Broadphase, 1000, 3000 );
+	profiler.end_frame();
+	ASSERT_TRUE( profiler.capturing() );
+	profiler.record( ProfilePhase::Solver, 5000, 6500 );
+	profiler.end_frame();
+	ASSERT_FALSE( profiler.capturing() );
+
+	// not captured
+	profiler.record( ProfilePhase::Solver, 7000, 8000 );
+	profiler.end_frame();
+
+	std::ifstream file( filename );
+	ASSERT_TRUE( file.is_open() );
+	std::stringstream stream;
+	stream << file.rdbuf();
+	const std::string trace = stream.str();
+	file.close();
+	std::remove( filename.c_str() );
+
+	ASSERT_EQ( trace.find( "{\"traceEvents\":[" ), 0u );
+	ASSERT_NE( trace.find( "\"name\":\"Broadphase\",\"cat\":\"physics\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":1,\"dur\":2}" ), std::string::npos );
+	ASSERT_NE( trace.find( "\"name\":\"Solver\",\"cat\":\"physics\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":5,\"dur\":1.5}" ), std::string::npos );
+	ASSERT_EQ( trace.find( "\"ts\":7" ), std::string::npos );
+}
@@ -0,0 +1,71 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_rigid_body.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "rigid_body.h"
+
+#include "math_utils.h"
+
+/**
+* @brief dynamic body with a non uniform inertia
+*/
+static RigidBody make_body()
+{
+	RigidBody body;
+	body.mass = 1.0f;
+	body.rot = quat( vec3( 0.4f, -1.2f, 0.7f ) );
+	body.set_inertia( mat3( 1.0f / 6.0f, 0.0f, 0.0f,
+							0.0f, 1.0f / 3.0f, 0.0f,
+							0.0f, 0.0f, 1.0f / 4.0f ) );
+	return body;
+}
+
+TEST( rigid_body, small_impulses_are_kept )
+{
+	RigidBody body = make_body();
+	body.apply_impulse( body.position, vec3( 0.25f, -0.5f, 0.0f ) );
+
+	ASSERT_FLOAT_EQ( body.linear_momentum.x, 0.25f );
+	ASSERT_FLOAT_EQ( body.linear_momentum.y, -0.5f );
+}
+
+TEST( rigid_body, cached_world_inertia_follows_the_orientation )
+{
+	RigidBody body = make_body();
+	body.angular_velocity = vec3( 1.0f, 2.0f, -0.5f );
+	body.integrate( 0.1f );
+
+	const mat3 rotation = glm::mat3_cast( body.rot );
+	const mat3 expected = rotation * body.I_inv_body * transpose( rotation );
+
+	for ( int i = 0; i < 3; i++ )
+		for ( int j = 0; j < 3; j++ )
+			ASSERT_NEAR( body.get_oriented_inv_I()[i][j], expected[i][j], 0.0001f );
+}
+
+TEST( rigid_body, set_inertia_gives_rotational_response )
+{
+	// never added to the physics, set_inertia alone is enough to rotate
+	RigidBody body = make_body();
+	body.apply_impulse( body.position + vec3( 0.5f, 0.0f, 0.0f ), vec3( 0.0f, 1.0f, 0.0f ) );
+
+	ASSERT_GT( glm::length( body.angular_velocity ), 0.0f );
+	const vec3 expected = body.I_inv_world * body.angular_momentum;
+	for ( int i = 0; i < 3; i++ )
+		ASSERT_NEAR( body.angular_velocity[i], expected[i], 0.0001f );
+
+	// a zero tensor has no rotational response
+	RigidBody point;
+	point.mass = 1.0f;
+	point.set_inertia( mat3( 0.0f ) );
+	point.apply_impulse( point.position + vec3( 0.5f, 0.0f, 0.0f ), vec3( 0.0f, 1.0f, 0.0f ) );
+	ASSERT_EQ( point.I_inv_body, mat3( 0.0f ) );
+	ASSERT_EQ( point.angular_velocity, vec3( 0.0f ) );
+}
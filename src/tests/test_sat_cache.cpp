@@ -0,0 +1,158 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_sat_cache.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "collision.h"
+#include "sat_cache.h"
+#include "profiler.h"
+#include "test_helpers.h"
+
+#include <random>
+
+/**
+* @brief cube body at a position
+*/
+static RigidBody make_cube( const vec3 position, const quat rotation = quat() )
+{
+	RigidBody body;
+	body.mesh = load_shared_mesh( "cube" );
+	body.mass = 1.0f;
+	body.position = position;
+	body.rot = rotation;
+	body.update_world_inertia();
+	return body;
+}
+
+TEST( sat_cache, separated_pair_hits_its_cached_axis )
+{
+	RigidBody a = make_cube( vec3( 0.0f ) );
+	RigidBody b = make_cube( vec3( 1.5f, 0.0f, 0.0f ) );
+
+	SatCache cache;
+	ContactManifold contact;
+
+	// the first query finds the face
+	SeparatingAxis* axis = &cache.find( 0u, 1u );
+	ASSERT_FALSE( overlap_sat( a, b, contact, axis ) );
+	ASSERT_NE( axis->type, SeparatingAxisType::None );
+	ASSERT_FALSE( axis->hit );
+	cache.end_step();
+
+	// moving closer keeps the same axis
+	b.position.x = 1.2f;
+	axis = &cache.find( 0u, 1u );
+	ASSERT_FALSE( overlap_sat( a, b, contact, axis ) );
+	ASSERT_TRUE( axis->hit );
+	cache.end_step();
+
+	ASSERT_EQ( cache.queries(), 1u );
+	ASSERT_EQ( cache.hits(), 1u );
+
+	// overlapping, the full query runs and there is nothing to cache
+	b.position.x = 0.9f;
+	axis = &cache.find( 0u, 1u );
+	ASSERT_TRUE( overlap_sat( a, b, contact, axis ) );
+	ASSERT_EQ( axis->type, SeparatingAxisType::None );
+	ASSERT_FALSE( axis->hit );
+}
+
+TEST( sat_cache, pairs_not_queried_are_evicted )
+{
+	SatCache cache;
+	cache.find( 0u, 1u );
+	cache.find( 0u, 2u );
+	cache.end_step();
+	ASSERT_EQ( cache.size(), 2u );
+
+	cache.find( 0u, 2u );
+	cache.end_step();
+	ASSERT_EQ( cache.size(), 1u );
+	ASSERT_EQ( cache.queries(), 1u );
+
+	cache.clear();
+	ASSERT_EQ( cache.size(), 0u );
+}
+
+TEST( sat_cache, cached_queries_match_the_full_query )
+{
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+	std::uniform_real_distribution<float> offset( -0.05f, 0.05f );
+
+	SatCache cache;
+
+	// a cube tumbling through another one, every step against a fresh query
+	RigidBody a = make_cube( vec3( 0.0f ) );
+	RigidBody b = make_cube( vec3( 3.0f, 0.4f, -0.2f ), quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) ) );
+	const quat spin = quat( vec3( 0.05f, 0.03f, -0.04f ) );
+
+	unsigned hits = 0u;
+	for ( unsigned step = 0u; step < 120u; step++ )
+	{
+		b.position += vec3( -0.05f, offset( generator ), offset( generator ) );
+		b.rot = normalize( spin * b.rot );
+
+		ContactManifold full_contact;
+		ContactManifold cached_contact;
+		const bool full = overlap_sat( a, b, full_contact );
+
+		SeparatingAxis& axis = cache.find( 0u, 1u );
+		const bool cached = overlap_sat( a, b, cached_contact, &axis );
+		hits += axis.hit ? 1u : 0u;
+		cache.end_step();
+
+		ASSERT_EQ( full, cached ) << "step " << step;
+		if ( full == true )
+		{
+			ASSERT_EQ( full_contact.feature, cached_contact.feature );
+			ASSERT_EQ( full_contact.points.size(), cached_contact.points.size() );
+		}
+	}
+
+	// most of the separated steps reuse the axis
+	ASSERT_GT( hits, 0u );
+}
+
+#if PROFILER_ENABLED
+TEST( sat_cache, cached_supports_shorten_the_hill_climbing )
+{
+	Profiler& profiler = Profiler::get_instance();
+	const unsigned queries = static_cast<unsigned>( ProfileCounter::SupportQueries );
+	const unsigned steps = static_cast<unsigned>( ProfileCounter::SupportSteps );
+
+	// a cube spinning slowly inside another one, the face query visits every face
+	RigidBody a = make_cube( vec3( 0.0f ) );
+	RigidBody b = make_cube( vec3( 0.8f, 0.3f, 0.1f ), quat( vec3( 0.3f, 0.4f, 0.2f ) ) );
+	const quat spin = quat( vec3( 0.02f, 0.01f, -0.015f ) );
+
+	std::vector<unsigned> supports;
+	unsigned cold_steps = 0u;
+	unsigned warm_steps = 0u;
+	for ( unsigned step = 0u; step < 60u; step++ )
+	{
+		b.rot = normalize( spin * b.rot );
+
+		profiler.end_frame();
+		const ContactFace cold = has_separating_axis_face( a, b );
+		profiler.end_frame();
+		cold_steps += profiler.last_frame().counters[steps];
+		ASSERT_EQ( profiler.last_frame().counters[queries], a.mesh->faces().size() );
+
+		const ContactFace warm = has_separating_axis_face( a, b, &supports );
+		profiler.end_frame();
+		if ( step > 0u )
+			warm_steps += profiler.last_frame().counters[steps];
+
+		ASSERT_NEAR( cold.separation, warm.separation, 1e-5f );
+	}
+
+	ASSERT_LT( warm_steps * 2u, cold_steps );
+}
+#endif
@@ -0,0 +1,168 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_solver.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "solver.h"
+#include "rigid_body.h"
+#include "test_helpers.h"
+
+#include "math_utils.h"
+
+#include <set>
+
+TEST( solver, colors_do_not_share_dynamic_bodies )
+{
+	std::vector<RigidBody> bodies;
+	std::vector<ContactManifold> contacts;
+	make_stacks( bodies, contacts, 10u, 6u );
+
+	SolverConstraint solver;
+	solver.set_iteration_count( 1 );
+	solver.set_baumgarte( 0.2f );
+	solver.set_mode( SolverMode::Colored );
+	solver.solve_collision( contacts, 1.0f / 60.0f );
+
+	// a stack is a chain, two colors are enough
+	ASSERT_EQ( solver.color_count(), 2u );
+	ASSERT_EQ( solver.constraints().size(), contacts.size() );
+
+	std::vector<std::set<const RigidBody*>> used( solver.color_count() );
+	unsigned floor_uses = 0u;
+
+	for ( const ContactConstraint& constraint : solver.constraints() )
+	{
+		ASSERT_LT( constraint.color, solver.color_count() );
+
+		for ( const RigidBody* body : { contacts[constraint.contact].body_A, contacts[constraint.contact].body_B } )
+		{
+			// the static floor is shared by every bottom box
+			if ( body->mass == 0.0f )
+			{
+				floor_uses++;
+				continue;
+			}
+
+			ASSERT_TRUE( used[constraint.color].insert( body ).second );
+		}
+	}
+
+	ASSERT_EQ( floor_uses, 10u );
+}
+
+TEST( solver, colored_result_does_not_depend_on_threads )
+{
+	std::vector<RigidBody> serial_bodies;
+	std::vector<RigidBody> parallel_bodies;
+	std::vector<ContactManifold> serial_contacts;
+	std::vector<ContactManifold> parallel_contacts;
+	make_stacks( serial_bodies, serial_contacts, 40u, 10u );
+	make_stacks( parallel_bodies, parallel_contacts, 40u, 10u );
+
+	SolverConstraint serial;
+	serial.set_iteration_count( 8 );
+	serial.set_baumgarte( 0.2f );
+	serial.set_mode( SolverMode::Colored );
+	serial.solve_collision( serial_contacts, 1.0f / 60.0f );
+
+	// small tasks so every thread gets work
+	ThreadPool pool( 4u );
+	const unsigned grain = SolverConstraint::grain;
+	SolverConstraint::grain = 4u;
+
+	SolverConstraint parallel;
+	parallel.set_iteration_count( 8 );
+	parallel.set_baumgarte( 0.2f );
+	parallel.set_mode( SolverMode::Colored );
+	parallel.set_thread_pool( &pool );
+	parallel.solve_collision( parallel_contacts, 1.0f / 60.0f );
+
+	SolverConstraint::grain = grain;
+
+	// the constraints of a color do not touch the same bodies, so the order does not matter
+	for ( unsigned i = 0u; i < serial_bodies.size(); i++ )
+	{
+		ASSERT_EQ( serial_bodies[i].linear_momentum, parallel_bodies[i].linear_momentum );
+		ASSERT_EQ( serial_bodies[i].angular_momentum, parallel_bodies[i].angular_momentum );
+	}
+
+	for ( unsigned i = 0u; i < serial_contacts.size(); i++ )
+		for ( unsigned k = 0u; k < serial_contacts[i].points.size(); k++ )
+			ASSERT_EQ( serial_contacts[i].points[k].impulse, parallel_contacts[i].points[k].impulse );
+}
+
+TEST( solver, wide_matches_colored )
+{
+	std::vector<RigidBody> colored_bodies;
+	std::vector<RigidBody> wide_bodies;
+	std::vector<ContactManifold> colored_contacts;
+	std::vector<ContactManifold> wide_contacts;
+	make_stacks( colored_bodies, colored_contacts, 13u, 7u );
+	make_stacks( wide_bodies, wide_contacts, 13u, 7u );
+
+	// lanes with a different number of points and a warm started impulse
+	for ( unsigned i = 0u; i < colored_contacts.size(); i += 3u )
+	{
+		colored_contacts[i].points.resize( 1u + i % 4u );
+		wide_contacts[i].points.resize( 1u + i % 4u );
+		colored_contacts[i].points[0].impulse = wide_contacts[i].points[0].impulse = 0.01f;
+		colored_contacts[i].impulse_u = wide_contacts[i].impulse_u = 0.001f;
+	}
+
+	SolverConstraint colored;
+	colored.set_iteration_count( 10 );
+	colored.set_baumgarte( 0.2f );
+	colored.set_mode( SolverMode::Colored );
+	colored.solve_collision( colored_contacts, 1.0f / 60.0f );
+
+	SolverConstraint wide;
+	wide.set_iteration_count( 10 );
+	wide.set_baumgarte( 0.2f );
+	wide.set_mode( SolverMode::Wide );
+	wide.solve_collision( wide_contacts, 1.0f / 60.0f );
+
+	// same order of the constraints, only the rounding differs
+	for ( unsigned i = 0u; i < colored_bodies.size(); i++ )
+	{
+		for ( unsigned c = 0u; c < 3u; c++ )
+		{
+			ASSERT_NEAR( colored_bodies[i].linear_momentum[c], wide_bodies[i].linear_momentum[c], 1e-4f );
+			ASSERT_NEAR( colored_bodies[i].angular_momentum[c], wide_bodies[i].angular_momentum[c], 1e-4f );
+		}
+	}
+
+	for ( unsigned i = 0u; i < colored_contacts.size(); i++ )
+	{
+		for ( unsigned k = 0u; k < colored_contacts[i].points.size(); k++ )
+			ASSERT_NEAR( colored_contacts[i].points[k].impulse, wide_contacts[i].points[k].impulse, 1e-4f );
+		ASSERT_NEAR( colored_contacts[i].impulse_u, wide_contacts[i].impulse_u, 1e-4f );
+		ASSERT_NEAR( colored_contacts[i].impulse_v, wide_contacts[i].impulse_v, 1e-4f );
+		ASSERT_NEAR( colored_contacts[i].impulse_t, wide_contacts[i].impulse_t, 1e-4f );
+	}
+}
+
+TEST( solver, every_mode_stops_the_stacks )
+{
+	for ( const SolverMode mode : { SolverMode::Sequential, SolverMode::Colored, SolverMode::Wide } )
+	{
+		std::vector<RigidBody> bodies;
+		std::vector<ContactManifold> contacts;
+		make_stacks( bodies, contacts, 4u, 5u );
+
+		SolverConstraint solver;
+		solver.set_iteration_count( 50 );
+		solver.set_baumgarte( 0.0f );
+		solver.set_mode( mode );
+		solver.solve_collision( contacts, 1.0f / 60.0f );
+
+		// nothing falls through the floor or through the box below
+		for ( unsigned i = 1u; i < bodies.size(); i++ )
+			ASSERT_NEAR( bodies[i].linear_momentum.y, 0.0f, 0.05f );
+	}
+}
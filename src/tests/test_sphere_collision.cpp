@@ -0,0 +1,168 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_sphere_collision.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "sphere_collision.h"
+#include "narrowphase.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+
+TEST( sphere_collision, sphere_against_sphere_and_box )
+{
+	HalfEdgeMesh* sphere_mesh = load_mesh( "sphere" );
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody a;
+	RigidBody b;
+	a.mesh = b.mesh = sphere_mesh;
+	a.shape = b.shape = ShapeType::Sphere;
+	a.scl = b.scl = vec3( 0.5f );
+	b.position = vec3( 0.0f, 0.9f, 0.0f );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_sphere( a, b, contact ) );
+	ASSERT_EQ( contact.points.size(), 1u );
+	ASSERT_NEAR( contact.points[0].depth, 0.1f, 1e-5f );
+
+	// from the other body to the sphere
+	ASSERT_EQ( contact.body_A, &b );
+	ASSERT_NEAR( contact.normal.y, -1.0f, 1e-5f );
+
+	b.position.y = 1.1f;
+	ASSERT_FALSE( overlap_sphere( a, b, contact ) );
+
+	// on a face, over an edge and sunk into a box
+	RigidBody box;
+	box.mesh = cube;
+	box.shape = ShapeType::Box;
+	box.scl = vec3( 4.0f, 1.0f, 4.0f );
+
+	a.position = vec3( 1.0f, 0.9f, 0.5f );
+	ASSERT_TRUE( overlap_sphere( a, box, contact ) );
+	ASSERT_EQ( contact.body_A, &box );
+	ASSERT_NEAR( contact.points[0].depth, 0.1f, 1e-5f );
+	ASSERT_NEAR( contact.normal.y, 1.0f, 1e-5f );
+
+	a.position = vec3( 2.3f, 0.8f, 0.0f );
+	ASSERT_TRUE( overlap_sphere( a, box, contact ) );
+	ASSERT_NEAR( contact.points[0].depth, 0.5f - std::sqrt( 0.3f * 0.3f * 2.0f ), 1e-5f );
+	ASSERT_NEAR( contact.normal.x, std::sqrt( 0.5f ), 1e-5f );
+
+	a.position = vec3( 0.0f, 0.4f, 0.0f );
+	ASSERT_TRUE( overlap_sphere( a, box, contact ) );
+	ASSERT_NEAR( contact.points[0].depth, 0.6f, 1e-5f );
+	ASSERT_NEAR( contact.normal.y, 1.0f, 1e-5f );
+
+	delete sphere_mesh;
+	delete cube;
+}
+
+TEST( sphere_collision, hull_matches_box )
+{
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	std::mt19937 generator( 550u );
+	std::uniform_real_distribution<float> coordinate( -1.5f, 1.5f );
+	std::uniform_real_distribution<float> angle( -glm::pi<float>(), glm::pi<float>() );
+
+	// the same cube queried as a box and as a generic hull
+	RigidBody box;
+	box.mesh = cube;
+	box.scl = vec3( 1.0f, 2.0f, 0.5f );
+	box.rot = quat( vec3( angle( generator ), angle( generator ), angle( generator ) ) );
+
+	box.shape = ShapeType::Box;
+	const ShapeQuery box_query = make_shape_query( box, make_body_transform( box ) );
+	box.shape = ShapeType::Hull;
+	const ShapeQuery hull_query = make_shape_query( box, make_body_transform( box ) );
+
+	for ( unsigned i = 0u; i < 1000u; i++ )
+	{
+		const vec3 point( coordinate( generator ), coordinate( generator ), coordinate( generator ) );
+		const SurfacePoint from_box = surface_point( box_query, point );
+		const SurfacePoint from_hull = surface_point( hull_query, point );
+
+		ASSERT_NEAR( from_box.distance, from_hull.distance, 1e-4f ) << "point " << i;
+		ASSERT_NEAR( glm::length( from_box.point - from_hull.point ), 0.0f, 1e-3f ) << "point " << i;
+	}
+
+	delete cube;
+}
+
+TEST( sphere_collision, lying_capsule_rests_on_two_points )
+{
+	HalfEdgeMesh* capsule_mesh = load_mesh( "capsule" );
+	HalfEdgeMesh* cube = load_mesh( "cube" );
+
+	RigidBody capsule;
+	capsule.mesh = capsule_mesh;
+	capsule.shape = ShapeType::Capsule;
+	capsule.rot = quat( vec3( 0.0f, 0.0f, glm::half_pi<float>() ) );
+	capsule.position = vec3( 0.2f, 0.95f, 0.0f );
+
+	// radius 0.5 around a segment of length 1
+	const Capsule shape = make_capsule( capsule, make_body_transform( capsule ) );
+	ASSERT_NEAR( shape.radius, 0.5f, 1e-5f );
+	ASSERT_NEAR( glm::length( shape.end - shape.start ), 1.0f, 1e-5f );
+
+	RigidBody floor;
+	floor.mesh = cube;
+	floor.shape = ShapeType::Box;
+	floor.scl = vec3( 10.0f, 1.0f, 10.0f );
+
+	// in both orders of the dispatch, from the floor to the capsule
+	NarrowphasePolicy policy;
+	for ( const bool capsule_first : { true, false } )
+	{
+		ContactManifold contact;
+		if ( capsule_first )
+			ASSERT_TRUE( policy.shape_overlap( ShapeType::Capsule, ShapeType::Box )( capsule, floor, contact, make_body_transform( capsule ), make_body_transform( floor ) ) );
+		else
+			ASSERT_TRUE( policy.shape_overlap( ShapeType::Box, ShapeType::Capsule )( floor, capsule, contact, make_body_transform( floor ), make_body_transform( capsule ) ) );
+
+		ASSERT_EQ( contact.body_A, &floor );
+		ASSERT_EQ( contact.points.size(), 2u );
+		ASSERT_NEAR( contact.normal.y, 1.0f, 1e-4f );
+		for ( const ContactPoint& point : contact.points )
+			ASSERT_NEAR( point.depth, 0.05f, 1e-4f );
+	}
+
+	// crossing a capsule in the middle
+	RigidBody other = capsule;
+	other.rot = quat( vec3( glm::half_pi<float>(), 0.0f, 0.0f ) );
+	other.position = capsule.position + vec3( 0.0f, 0.9f, 0.0f );
+
+	ContactManifold contact;
+	ASSERT_TRUE( overlap_capsule( other, capsule, contact ) );
+	ASSERT_EQ( contact.points.size(), 1u );
+	ASSERT_NEAR( contact.points[0].depth, 0.1f, 1e-4f );
+	ASSERT_NEAR( contact.normal.y, 1.0f, 1e-4f );
+
+	delete capsule_mesh;
+	delete cube;
+}
+
+TEST( sphere_collision, analytic_inertia )
+{
+	const mat3 sphere = sphere_inertia_tensor( 2.0f, 0.5f );
+	ASSERT_FLOAT_EQ( sphere[0][0], 0.2f );
+	ASSERT_FLOAT_EQ( sphere[1][1], 0.2f );
+
+	// a capsule without cylinder is a sphere, a long one turns easier around its axis
+	const mat3 round = capsule_inertia_tensor( 2.0f, 0.5f, 0.0f );
+	ASSERT_FLOAT_EQ( round[0][0], 0.2f );
+	ASSERT_FLOAT_EQ( round[1][1], 0.2f );
+
+	const mat3 capsule = capsule_inertia_tensor( 2.0f, 0.5f, 1.0f );
+	ASSERT_LT( capsule[1][1], capsule[0][0] );
+	ASSERT_FLOAT_EQ( capsule[0][0], capsule[2][2] );
+}
@@ -0,0 +1,73 @@
+/* ---------------------------------------------------------------------------------------------------------
+Copyright (C) 2020 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior written
+consent of DigiPen Institute of Technology is prohibited.
+
+File Name: test_transform.cpp
+Author: Josu Cubero Ruiz de Gopegui, josu.cubero, 540001316
+Creation date: 10/17/2026
+----------------------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "transform.h"
+#include "rigid_body.h"
+
+/**
+* @brief check two points are the same
+*/
+static void expect_near( const vec3& a, const vec3& b )
+{
+	EXPECT_NEAR( a.x, b.x, 1e-4f );
+	EXPECT_NEAR( a.y, b.y, 1e-4f );
+	EXPECT_NEAR( a.z, b.z, 1e-4f );
+}
+
+TEST( transform, body_transform_matches_the_model_matrix )
+{
+	RigidBody body;
+	body.position = vec3( 1.0f, -2.0f, 3.0f );
+	body.scl = vec3( 2.0f, 0.5f, 1.5f );
+	body.rot = normalize( quat( vec3( 0.3f, 1.1f, -0.7f ) ) );
+
+	const BodyTransform transform = make_body_transform( body );
+	const mat4 model = body.model();
+	const mat4 inverse_model = inverse( model );
+
+	const vec3 points[] = { vec3( 0.0f ), vec3( 1.0f, 0.0f, 0.0f ), vec3( -0.5f, 2.0f, 0.25f ) };
+	for ( const vec3& point : points )
+	{
+		expect_near( transform.model.point( point ), vec3( model * vec4( point, 1.0f ) ) );
+		expect_near( transform.model.vector( point ), vec3( model * vec4( point, 0.0f ) ) );
+		expect_near( transform.inverse.point( point ), vec3( inverse_model * vec4( point, 1.0f ) ) );
+		expect_near( transform.inverse.point( transform.model.point( point ) ), point );
+	}
+
+	const mat4 matrix = transform.model.matrix();
+	for ( unsigned i = 0u; i < 4u; i++ )
+		for ( unsigned j = 0u; j < 4u; j++ )
+			EXPECT_NEAR( matrix[i][j], model[i][j], 1e-5f );
+}
+
+TEST( transform, pair_transform_goes_between_the_bodies )
+{
+	RigidBody a;
+	a.position = vec3( 0.5f, 1.0f, -1.0f );
+	a.scl = vec3( 1.0f, 3.0f, 0.5f );
+	a.rot = normalize( quat( vec3( -0.4f, 0.2f, 0.9f ) ) );
+
+	RigidBody b;
+	b.position = vec3( -2.0f, 0.0f, 1.0f );
+	b.scl = vec3( 0.5f, 0.5f, 2.0f );
+	b.rot = normalize( quat( vec3( 1.2f, -0.3f, 0.1f ) ) );
+
+	const PairTransform pair = make_pair_transform( a, b );
+	const PairTransform swapped = swap_pair_transform( pair );
+
+	// a point of A in the space of B is the same world point
+	const vec3 point( 0.3f, -0.2f, 0.8f );
+	expect_near( pair.model_B.point( pair.A_to_B.point( point ) ), pair.model_A.point( point ) );
+	expect_near( pair.B_to_A.point( pair.A_to_B.point( point ) ), point );
+
+	expect_near( swapped.model_A.point( point ), pair.model_B.point( point ) );
+	expect_near( swapped.A_to_B.point( point ), pair.B_to_A.point( point ) );
+}